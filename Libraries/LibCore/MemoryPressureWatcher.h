@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/Function.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+
+namespace Core {
+
+class MemoryPressureWatcher {
+    AK_MAKE_NONCOPYABLE(MemoryPressureWatcher);
+
+public:
+    enum class Level : u8 {
+        Moderate,
+        Critical,
+    };
+
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> create();
+    virtual ~MemoryPressureWatcher() = default;
+
+    Function<void(Level)> on_memory_pressure;
+
+protected:
+    MemoryPressureWatcher() = default;
+};
+
+}
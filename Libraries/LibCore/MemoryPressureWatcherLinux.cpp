@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Optional.h>
+#include <AK/Platform.h>
+#include <AK/StringView.h>
+#include <LibCore/File.h>
+#include <LibCore/MemoryPressureWatcher.h>
+#include <LibCore/Timer.h>
+
+#if !defined(AK_OS_LINUX)
+static_assert(false, "This file must only be used for Linux");
+#endif
+
+namespace Core {
+
+// Pressure stall information reports the share of time in which tasks were stalled waiting on memory. "some" counts
+// the time in which at least one task was stalled, "full" the time in which all non-idle tasks were stalled at once.
+// https://docs.kernel.org/accounting/psi.html
+static constexpr auto pressure_stall_information_path = "/proc/pressure/memory"sv;
+static constexpr int pressure_poll_interval_ms = 2000;
+static constexpr double moderate_pressure_some_avg10_threshold = 10.0;
+static constexpr double critical_pressure_full_avg10_threshold = 10.0;
+
+struct MemoryStallAverages {
+    double some_avg10 { 0 };
+    double full_avg10 { 0 };
+};
+
+static ErrorOr<MemoryStallAverages> read_memory_stall_averages()
+{
+    auto file = TRY(File::open(pressure_stall_information_path, File::OpenMode::Read));
+    auto contents = TRY(file->read_until_eof());
+
+    MemoryStallAverages averages;
+    for (auto line : StringView { contents }.split_view('\n')) {
+        auto fields = line.split_view(' ');
+        if (fields.size() < 2 || !fields[1].starts_with("avg10="sv))
+            continue;
+
+        auto avg10 = fields[1].substring_view("avg10="sv.length()).to_number<double>();
+        if (!avg10.has_value())
+            continue;
+
+        if (fields[0] == "some"sv)
+            averages.some_avg10 = *avg10;
+        else if (fields[0] == "full"sv)
+            averages.full_avg10 = *avg10;
+    }
+
+    return averages;
+}
+
+class MemoryPressureWatcherImpl final : public MemoryPressureWatcher {
+public:
+    static ErrorOr<NonnullOwnPtr<MemoryPressureWatcherImpl>> create()
+    {
+        // Fail early if the kernel doesn't report pressure stall information.
+        TRY(read_memory_stall_averages());
+
+        return adopt_own(*new MemoryPressureWatcherImpl());
+    }
+
+    virtual ~MemoryPressureWatcherImpl() override
+    {
+        m_timer->stop();
+    }
+
+private:
+    MemoryPressureWatcherImpl()
+        : m_timer(Timer::create_repeating(pressure_poll_interval_ms, [this] { check_memory_pressure(); }))
+    {
+        m_timer->start();
+    }
+
+    void check_memory_pressure()
+    {
+        auto averages = read_memory_stall_averages();
+        if (averages.is_error())
+            return;
+
+        Optional<Level> level;
+        if (averages.value().full_avg10 >= critical_pressure_full_avg10_threshold)
+            level = Level::Critical;
+        else if (averages.value().some_avg10 >= moderate_pressure_some_avg10_threshold)
+            level = Level::Moderate;
+
+        // Only notify when the pressure rises, rather than on every poll while it stays high.
+        auto should_notify = level.has_value() && (!m_last_level.has_value() || *level > *m_last_level);
+        m_last_level = level;
+
+        if (should_notify && on_memory_pressure)
+            on_memory_pressure(*level);
+    }
+
+    NonnullRefPtr<Timer> m_timer;
+    Optional<Level> m_last_level;
+};
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return MemoryPressureWatcherImpl::create();
+}
+
+}
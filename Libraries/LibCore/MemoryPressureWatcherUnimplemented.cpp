@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibCore/MemoryPressureWatcher.h>
+
+namespace Core {
+
+ErrorOr<NonnullOwnPtr<MemoryPressureWatcher>> MemoryPressureWatcher::create()
+{
+    return Error::from_errno(ENOTSUP);
+}
+
+}
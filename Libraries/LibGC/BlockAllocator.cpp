@@ -12,6 +12,9 @@
 #include <AK/Vector.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/HeapBlock.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibThreading/Mutex.h>
+#include <LibThreading/Thread.h>
 #include <sys/mman.h>
 
 #if defined(AK_OS_MACOS)
@@ -31,9 +34,110 @@
 
 namespace GC {
 
+static void decommit_block(void* block)
+{
+#if defined(AK_OS_WINDOWS)
+    DWORD ret = DiscardVirtualMemory(block, HeapBlock::BLOCK_SIZE);
+    if (ret != ERROR_SUCCESS) {
+        warnln("{}", Error::from_windows_error(ret));
+        VERIFY_NOT_REACHED();
+    }
+#elif defined(MADV_FREE_REUSE) && defined(MADV_FREE_REUSABLE)
+    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE_REUSABLE) < 0) {
+        perror("madvise(MADV_FREE_REUSABLE)");
+        VERIFY_NOT_REACHED();
+    }
+#elif defined(MADV_FREE)
+    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE) < 0) {
+        perror("madvise(MADV_FREE)");
+        VERIFY_NOT_REACHED();
+    }
+#elif defined(MADV_DONTNEED)
+    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_DONTNEED) < 0) {
+        perror("madvise(MADV_DONTNEED)");
+        VERIFY_NOT_REACHED();
+    }
+#else
+    (void)block;
+#endif
+}
+
+// Giving a block's memory back to the OS costs a syscall per block, which adds up quickly when a collection frees
+// thousands of blocks at once. This does that work on a background thread so it doesn't lengthen the GC pause.
+class BlockDecommitter {
+public:
+    static BlockDecommitter& the()
+    {
+        // NOTE: This is leaked on purpose, since the decommit thread runs for the lifetime of the process.
+        static BlockDecommitter* s_the = new BlockDecommitter;
+        return *s_the;
+    }
+
+    void enqueue(BlockAllocator& allocator, void* block)
+    {
+        Threading::MutexLocker locker(m_mutex);
+        m_pending_blocks.append({ &allocator, block });
+        m_condition.signal();
+    }
+
+private:
+    BlockDecommitter()
+        : m_thread(Threading::Thread::construct([this] { return decommit_blocks(); }, "GC Decommitter"sv))
+    {
+        m_thread->start();
+        m_thread->detach();
+    }
+
+    intptr_t decommit_blocks()
+    {
+        Vector<PendingBlock> blocks;
+        while (true) {
+            {
+                Threading::MutexLocker locker(m_mutex);
+                m_condition.wait_while([&] { return m_pending_blocks.is_empty(); });
+                swap(blocks, m_pending_blocks);
+            }
+
+            for (auto& pending_block : blocks) {
+                decommit_block(pending_block.block);
+                pending_block.allocator->did_decommit_block({}, pending_block.block);
+            }
+            blocks.clear_with_capacity();
+        }
+        VERIFY_NOT_REACHED();
+    }
+
+    struct PendingBlock {
+        BlockAllocator* allocator { nullptr };
+        void* block { nullptr };
+    };
+
+    Threading::Mutex m_mutex;
+    Threading::ConditionVariable m_condition { m_mutex };
+    Vector<PendingBlock> m_pending_blocks;
+    NonnullRefPtr<Threading::Thread> m_thread;
+};
+
+struct BlockAllocator::BlockCache {
+    mutable Threading::Mutex mutex;
+    Threading::ConditionVariable blocks_pending_decommit_condition { mutex };
+    Vector<void*> blocks;
+    size_t blocks_pending_decommit { 0 };
+};
+
+BlockAllocator::BlockAllocator()
+    : m_cache(make<BlockCache>())
+{
+}
+
 BlockAllocator::~BlockAllocator()
 {
-    for (auto* block : m_blocks) {
+    Threading::MutexLocker locker(m_cache->mutex);
+
+    // Blocks that are still being decommitted belong to us, so wait for the decommit thread to hand them back.
+    m_cache->blocks_pending_decommit_condition.wait_while([&] { return m_cache->blocks_pending_decommit > 0; });
+
+    for (auto* block : m_cache->blocks) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
 #if defined(AK_OS_MACOS)
         kern_return_t kr = mach_vm_deallocate(mach_task_self(), reinterpret_cast<mach_vm_address_t>(block), HeapBlock::BLOCK_SIZE);
@@ -51,10 +155,17 @@ BlockAllocator::~BlockAllocator()
 
 void* BlockAllocator::allocate_block([[maybe_unused]] char const* name)
 {
-    if (!m_blocks.is_empty()) {
-        // To reduce predictability, take a random block from the cache.
-        size_t random_index = get_random_uniform(m_blocks.size());
-        auto* block = m_blocks.unstable_take(random_index);
+    void* cached_block = nullptr;
+    {
+        Threading::MutexLocker locker(m_cache->mutex);
+        if (!m_cache->blocks.is_empty()) {
+            // To reduce predictability, take a random block from the cache.
+            size_t random_index = get_random_uniform(m_cache->blocks.size());
+            cached_block = m_cache->blocks.unstable_take(random_index);
+        }
+    }
+
+    if (auto* block = cached_block) {
         ASAN_UNPOISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
         LSAN_REGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
 #if defined(MADV_FREE_REUSE) && defined(MADV_FREE_REUSABLE)
@@ -98,32 +209,29 @@ void BlockAllocator::deallocate_block(void* block)
 {
     VERIFY(block);
 
-#if defined(AK_OS_WINDOWS)
-    DWORD ret = DiscardVirtualMemory(block, HeapBlock::BLOCK_SIZE);
-    if (ret != ERROR_SUCCESS) {
-        warnln("{}", Error::from_windows_error(ret));
-        VERIFY_NOT_REACHED();
-    }
-#elif defined(MADV_FREE_REUSE) && defined(MADV_FREE_REUSABLE)
-    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE_REUSABLE) < 0) {
-        perror("madvise(MADV_FREE_REUSABLE)");
-        VERIFY_NOT_REACHED();
-    }
-#elif defined(MADV_FREE)
-    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_FREE) < 0) {
-        perror("madvise(MADV_FREE)");
-        VERIFY_NOT_REACHED();
-    }
-#elif defined(MADV_DONTNEED)
-    if (madvise(block, HeapBlock::BLOCK_SIZE, MADV_DONTNEED) < 0) {
-        perror("madvise(MADV_DONTNEED)");
-        VERIFY_NOT_REACHED();
-    }
-#endif
-
     ASAN_POISON_MEMORY_REGION(block, HeapBlock::BLOCK_SIZE);
     LSAN_UNREGISTER_ROOT_REGION(block, HeapBlock::BLOCK_SIZE);
-    m_blocks.append(block);
+
+    {
+        Threading::MutexLocker locker(m_cache->mutex);
+        ++m_cache->blocks_pending_decommit;
+    }
+    BlockDecommitter::the().enqueue(*this, block);
+}
+
+void BlockAllocator::did_decommit_block(Badge<BlockDecommitter>, void* block)
+{
+    Threading::MutexLocker locker(m_cache->mutex);
+    m_cache->blocks.append(block);
+    VERIFY(m_cache->blocks_pending_decommit > 0);
+    if (--m_cache->blocks_pending_decommit == 0)
+        m_cache->blocks_pending_decommit_condition.broadcast();
+}
+
+size_t BlockAllocator::cached_block_count() const
+{
+    Threading::MutexLocker locker(m_cache->mutex);
+    return m_cache->blocks.size() + m_cache->blocks_pending_decommit;
 }
 
 }
@@ -6,23 +6,32 @@
 
 #pragma once
 
-#include <AK/Vector.h>
+#include <AK/Badge.h>
+#include <AK/NonnullOwnPtr.h>
 #include <LibGC/Forward.h>
 
 namespace GC {
 
+class BlockDecommitter;
+
 class GC_API BlockAllocator {
 public:
-    BlockAllocator() = default;
+    BlockAllocator();
     ~BlockAllocator();
 
     void* allocate_block(char const* name);
     void deallocate_block(void*);
 
-    auto const& blocks() const { return m_blocks; }
+    size_t cached_block_count() const;
+
+    void did_decommit_block(Badge<BlockDecommitter>, void*);
 
 private:
-    Vector<void*> m_blocks;
+    // NOTE: Deallocated blocks are handed to a background thread that returns their memory to the OS,
+    //       and only come back into the cache once that's done. The cache is shared with that thread, so it
+    //       lives in BlockAllocator.cpp to keep the threading headers out of this one.
+    struct BlockCache;
+    NonnullOwnPtr<BlockCache> m_cache;
 };
 
 }
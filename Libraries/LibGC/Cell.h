@@ -190,7 +190,12 @@ public:
 protected:
     Cell() = default;
 
-    void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
+    void set_overrides_must_survive_garbage_collection(bool b)
+    {
+        m_overrides_must_survive_garbage_collection = b;
+        if (b)
+            HeapBlockBase::from_cell(this)->did_create_cell_overriding_must_survive_garbage_collection({});
+    }
 
 private:
     bool m_mark { false };
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <AK/QuickSort.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -55,4 +56,23 @@ void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
     m_usable_blocks.append(block);
 }
 
+void CellAllocator::sort_usable_blocks_by_occupancy(Badge<Heap>)
+{
+    // We allocate from the back of the usable block list. Keeping the fullest blocks there means that sparsely
+    // populated blocks aren't topped up with new cells after every GC, and get a chance to become empty so they
+    // can be returned to the BlockAllocator (and their memory to the OS).
+    Vector<HeapBlock*, 32> blocks;
+    for (auto& block : m_usable_blocks)
+        blocks.append(&block);
+    if (blocks.size() < 2)
+        return;
+
+    quick_sort(blocks, [](auto* a, auto* b) {
+        return a->live_cell_count_at_last_sweep() < b->live_cell_count_at_last_sweep();
+    });
+
+    for (auto* block : blocks)
+        m_usable_blocks.append(*block);
+}
+
 }
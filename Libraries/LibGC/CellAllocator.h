@@ -47,6 +47,7 @@ public:
 
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
+    void sort_usable_blocks_by_occupancy(Badge<Heap>);
 
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
@@ -28,8 +28,32 @@
 #    include <sanitizer/asan_interface.h>
 #endif
 
+#if defined(AK_OS_WINDOWS)
+#    include <AK/Windows.h>
+#else
+#    include <time.h>
+#endif
+
 namespace GC {
 
+// CPU time only advances while the thread is running, so unlike wall-clock time, it doesn't count the time we
+// spend waiting for the event loop to give us something to do.
+static AK::Duration current_thread_cpu_time()
+{
+#if defined(AK_OS_WINDOWS)
+    FILETIME creation_time, exit_time, kernel_time, user_time;
+    if (!GetThreadTimes(GetCurrentThread(), &creation_time, &exit_time, &kernel_time, &user_time))
+        return {};
+    auto to_100ns_units = [](FILETIME const& time) { return (static_cast<i64>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+    return AK::Duration::from_nanoseconds((to_100ns_units(kernel_time) + to_100ns_units(user_time)) * 100);
+#else
+    struct timespec now;
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now) < 0)
+        return {};
+    return AK::Duration::from_timespec(now);
+#endif
+}
+
 static Heap* s_the;
 
 Heap& Heap::the()
@@ -37,7 +61,7 @@ Heap& Heap::the()
     return *s_the;
 }
 
-Heap::Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roots)
+Heap::Heap(AK::Function<void(RootCollector&)> gather_embedder_roots)
     : m_gather_embedder_roots(move(gather_embedder_roots))
 {
     s_the = this;
@@ -69,7 +93,7 @@ void Heap::will_allocate(size_t size)
     m_allocated_bytes_since_last_gc += size;
 }
 
-static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+static Optional<FlatPtr> possible_pointer_from_value(FlatPtr data, FlatPtr min_block_address, FlatPtr max_block_address)
 {
     if constexpr (sizeof(FlatPtr*) == sizeof(NanBoxedValue)) {
         // Because NanBoxedValue stores pointers in non-canonical form we have to check if the top bytes
@@ -81,18 +105,34 @@ static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, Fl
         else
             possible_pointer = data;
         if (possible_pointer < min_block_address || possible_pointer > max_block_address)
-            return;
-        possible_pointers.set(possible_pointer, move(origin));
+            return {};
+        return possible_pointer;
     } else {
         static_assert((sizeof(NanBoxedValue) % sizeof(FlatPtr*)) == 0);
         if (data < min_block_address || data > max_block_address)
-            return;
+            return {};
         // In the 32-bit case we will look at the top and bottom part of NanBoxedValue separately we just
         // add both the upper and lower bytes as possible pointers.
-        possible_pointers.set(data, move(origin));
+        return data;
     }
 }
 
+static void add_possible_value(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr data, HeapRoot origin, FlatPtr min_block_address, FlatPtr max_block_address)
+{
+    if (auto possible_pointer = possible_pointer_from_value(data, min_block_address, max_block_address); possible_pointer.has_value())
+        possible_pointers.set(*possible_pointer, move(origin));
+}
+
+static Cell* cell_from_possible_pointer(HashTable<HeapBlock*> const& all_live_heap_blocks, FlatPtr possible_pointer)
+{
+    if (!possible_pointer)
+        return nullptr;
+    auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
+    if (!all_live_heap_blocks.contains(possible_heap_block))
+        return nullptr;
+    return possible_heap_block->cell_from_possible_pointer(possible_pointer);
+}
+
 void Heap::find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address)
 {
     min_address = explode_byte(0xff);
@@ -107,14 +147,8 @@ template<typename Callback>
 static void for_each_cell_among_possible_pointers(HashTable<HeapBlock*> const& all_live_heap_blocks, HashMap<FlatPtr, HeapRoot>& possible_pointers, Callback callback)
 {
     for (auto possible_pointer : possible_pointers.keys()) {
-        if (!possible_pointer)
-            continue;
-        auto* possible_heap_block = HeapBlock::from_cell(reinterpret_cast<Cell const*>(possible_pointer));
-        if (!all_live_heap_blocks.contains(possible_heap_block))
-            continue;
-        if (auto* cell = possible_heap_block->cell_from_possible_pointer(possible_pointer)) {
+        if (auto* cell = cell_from_possible_pointer(all_live_heap_blocks, possible_pointer))
             callback(cell, possible_pointer);
-        }
     }
 }
 
@@ -246,11 +280,23 @@ private:
     FlatPtr m_max_block_address;
 };
 
+// Used for heap graph dumps, which want to know where each root came from.
+class RootOriginRecorder final : public RootCollector {
+public:
+    virtual void add_root(Cell* cell, HeapRoot origin) override
+    {
+        if (cell)
+            roots.set(cell, origin);
+    }
+
+    HashMap<Cell*, HeapRoot> roots;
+};
+
 AK::JsonObject Heap::dump_graph()
 {
-    HashMap<Cell*, HeapRoot> roots;
-    gather_roots(roots);
-    GraphConstructorVisitor visitor(*this, roots);
+    RootOriginRecorder recorder;
+    gather_roots(recorder);
+    GraphConstructorVisitor visitor(*this, recorder.roots);
     visitor.visit_all_cells();
     return visitor.dump();
 }
@@ -262,23 +308,40 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
+        if (collection_type == CollectionType::CollectGarbage && m_gc_deferrals) {
+            m_should_gc_when_deferral_ends = true;
+            return;
+        }
+
+        auto collection_measurement_timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        auto cpu_time_at_collection_start = current_thread_cpu_time();
 
+        AK::Duration mark_duration;
         if (collection_type == CollectionType::CollectGarbage) {
-            if (m_gc_deferrals) {
-                m_should_gc_when_deferral_ends = true;
-                return;
-            }
-            HashMap<Cell*, HeapRoot> roots;
-            gather_roots(roots);
-            mark_live_cells(roots);
+            mark_live_cells();
+            mark_duration = collection_measurement_timer.elapsed_time();
         }
         finalize_unmarked_cells();
         sweep_weak_blocks();
         sweep_dead_cells(print_report, collection_measurement_timer);
 
+        auto collection_duration = collection_measurement_timer.elapsed_time();
+        auto cpu_time_at_collection_end = current_thread_cpu_time();
+        if (collection_type == CollectionType::CollectGarbage) {
+            if (m_cpu_time_at_last_collection_end.has_value()) {
+                auto mutator_cpu_time = cpu_time_at_collection_start - *m_cpu_time_at_last_collection_end;
+                adjust_heap_growth_factor(mutator_cpu_time, cpu_time_at_collection_end - cpu_time_at_collection_start);
+            }
+            update_gc_bytes_threshold();
+        }
+        m_cpu_time_at_last_collection_end = cpu_time_at_collection_end;
+
+        ++m_statistics.collection_count;
+        m_statistics.last_mark_duration = mark_duration;
+        m_statistics.total_mark_duration += mark_duration;
+        m_statistics.last_collection_duration = collection_duration;
+        m_statistics.total_collection_duration += collection_duration;
+
         if (print_report)
             dump_allocators();
     }
@@ -286,6 +349,78 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
     run_post_gc_tasks();
 }
 
+void Heap::adjust_heap_growth_factor(AK::Duration mutator_cpu_time, AK::Duration collection_cpu_time)
+{
+    auto total_cpu_time = mutator_cpu_time + collection_cpu_time;
+    if (mutator_cpu_time.is_negative() || collection_cpu_time.is_negative() || total_cpu_time.is_zero())
+        return;
+
+    // If we're spending a large share of our time collecting garbage, let the heap grow more before the next
+    // collection. Once collections become cheap relative to the time spent running, tighten it back up to save memory.
+    static constexpr double high_gc_time_ratio = 0.10;
+    static constexpr double low_gc_time_ratio = 0.03;
+    static constexpr double growth_factor_step = 1.5;
+
+    auto gc_time_ratio = static_cast<double>(collection_cpu_time.to_nanoseconds()) / static_cast<double>(total_cpu_time.to_nanoseconds());
+    if (gc_time_ratio > high_gc_time_ratio)
+        m_heap_growth_factor = min(m_heap_growth_factor * growth_factor_step, GC_MAX_HEAP_GROWTH_FACTOR);
+    else if (gc_time_ratio < low_gc_time_ratio)
+        m_heap_growth_factor = max(m_heap_growth_factor / growth_factor_step, GC_MIN_HEAP_GROWTH_FACTOR);
+}
+
+void Heap::update_gc_bytes_threshold()
+{
+    auto threshold = static_cast<size_t>(static_cast<double>(m_live_cell_bytes_after_last_gc) * m_heap_growth_factor);
+
+    // Don't let the heap grow past its budget. We still allow GC_MIN_BYTES_THRESHOLD of allocation between
+    // collections though, so that a heap that's over budget doesn't end up collecting after every allocation.
+    if (m_memory_budget) {
+        auto headroom = m_memory_budget > m_live_cell_bytes_after_last_gc ? m_memory_budget - m_live_cell_bytes_after_last_gc : 0;
+        threshold = min(threshold, headroom);
+    }
+
+    m_gc_bytes_threshold = max(threshold, GC_MIN_BYTES_THRESHOLD);
+}
+
+void Heap::set_memory_budget(size_t budget)
+{
+    m_memory_budget = budget;
+    update_gc_bytes_threshold();
+}
+
+void Heap::did_receive_memory_pressure(MemoryPressure pressure)
+{
+    // Trade GC time for memory until the heap has shown that it can afford to grow again.
+    m_heap_growth_factor = GC_MIN_HEAP_GROWTH_FACTOR;
+
+    if (pressure == MemoryPressure::Critical && !m_collecting_garbage) {
+        m_allocated_bytes_since_last_gc = 0;
+        collect_garbage();
+        return;
+    }
+
+    update_gc_bytes_threshold();
+}
+
+bool Heap::collect_garbage_during_idle_time(AK::Duration available_time)
+{
+    if (m_collecting_garbage || m_gc_deferrals)
+        return false;
+
+    // Collecting before a good chunk of the threshold has been allocated would just make us collect more often.
+    if (m_allocated_bytes_since_last_gc < m_gc_bytes_threshold / 2)
+        return false;
+
+    // Don't start a collection that we expect to overrun the idle period.
+    if (m_statistics.last_collection_duration > available_time)
+        return false;
+
+    m_allocated_bytes_since_last_gc = 0;
+    collect_garbage();
+    ++m_statistics.idle_collection_count;
+    return true;
+}
+
 void Heap::run_post_gc_tasks()
 {
     auto tasks = move(m_post_gc_tasks);
@@ -342,7 +477,7 @@ void Heap::dump_allocators()
         builder.appendff(" x {}", total_live_cells);
 
         size_t cost = blocks.size() * HeapBlock::BLOCK_SIZE / KiB;
-        size_t reserved = allocator.block_allocator().blocks().size() * HeapBlock::BLOCK_SIZE / KiB;
+        size_t reserved = allocator.block_allocator().cached_block_count() * HeapBlock::BLOCK_SIZE / KiB;
         builder.appendff(", cost: {} KiB, reserved: {} KiB", cost, reserved);
 
         size_t total_dead_bytes = ((blocks.size() * cell_count) - total_live_cells) * allocator.cell_size();
@@ -366,13 +501,15 @@ void Heap::enqueue_post_gc_task(AK::Function<void()> task)
     m_post_gc_tasks.append(move(task));
 }
 
-void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
+void Heap::gather_roots(RootCollector& roots)
 {
+    dbgln_if(HEAP_DEBUG, "gather_roots:");
+
     m_gather_embedder_roots(roots);
     gather_conservative_roots(roots);
 
     for (auto& root : m_roots)
-        roots.set(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
+        roots.add_root(root.cell(), HeapRoot { .type = HeapRoot::Type::Root, .location = &root.source_location() });
 
     for (auto& vector : m_root_vectors)
         vector.gather_roots(roots);
@@ -381,23 +518,20 @@ void Heap::gather_roots(HashMap<Cell*, HeapRoot>& roots)
         hash_map.gather_roots(roots);
 
     for_each_block([&](auto& block) {
+        if (!block.has_cells_overriding_must_survive_garbage_collection())
+            return IterationDecision::Continue;
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (cell_must_survive_garbage_collection(*cell)) {
-                roots.set(cell, HeapRoot { .type = HeapRoot::Type::MustSurviveGC });
+                roots.add_root(cell, HeapRoot { .type = HeapRoot::Type::MustSurviveGC });
             }
         });
         return IterationDecision::Continue;
     });
-
-    if constexpr (HEAP_DEBUG) {
-        dbgln("gather_roots:");
-        for (auto* root : roots.keys())
-            dbgln("  + {}", root);
-    }
 }
 
 #ifdef HAS_ADDRESS_SANITIZER
-NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>& possible_pointers, FlatPtr addr, FlatPtr min_block_address, FlatPtr max_block_address)
+template<typename Callback>
+NO_SANITIZE_ADDRESS static void for_each_asan_fake_stack_value(FlatPtr addr, Callback callback)
 {
     void* begin = nullptr;
     void* end = nullptr;
@@ -408,17 +542,18 @@ NO_SANITIZE_ADDRESS void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, Hea
             void const* real_address = *real_stack_addr;
             if (real_address == nullptr)
                 continue;
-            add_possible_value(possible_pointers, reinterpret_cast<FlatPtr>(real_address), HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
+            callback(reinterpret_cast<FlatPtr>(real_address));
         }
     }
 }
 #else
-void Heap::gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr, FlatPtr)
+template<typename Callback>
+static void for_each_asan_fake_stack_value(FlatPtr, Callback)
 {
 }
 #endif
 
-NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot>& roots)
+NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(RootCollector& roots)
 {
     FlatPtr dummy;
 
@@ -427,49 +562,59 @@ NO_SANITIZE_ADDRESS void Heap::gather_conservative_roots(HashMap<Cell*, HeapRoot
     jmp_buf buf;
     setjmp(buf);
 
-    HashMap<FlatPtr, HeapRoot> possible_pointers;
-
-    auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
-
     FlatPtr min_block_address, max_block_address;
     find_min_and_max_block_addresses(min_block_address, max_block_address);
 
+    HashTable<HeapBlock*> all_live_heap_blocks;
+    for_each_block([&](auto& block) {
+        all_live_heap_blocks.set(&block);
+        return IterationDecision::Continue;
+    });
+
+    // NOTE: Possible pointers are handed to the RootCollector as soon as we find them. The same cell may show up
+    //       more than once, which collectors deal with anyway.
+    auto add_possible_root = [&](FlatPtr data, HeapRoot origin) {
+        auto possible_pointer = possible_pointer_from_value(data, min_block_address, max_block_address);
+        if (!possible_pointer.has_value())
+            return;
+        auto* cell = cell_from_possible_pointer(all_live_heap_blocks, *possible_pointer);
+        if (!cell)
+            return;
+        if (cell->state() == Cell::State::Live) {
+            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
+            roots.add_root(cell, origin);
+        } else {
+            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
+        }
+    };
+
+    auto* raw_jmp_buf = reinterpret_cast<FlatPtr const*>(buf);
+
     for (size_t i = 0; i < ((size_t)sizeof(buf)) / sizeof(FlatPtr); ++i)
-        add_possible_value(possible_pointers, raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer }, min_block_address, max_block_address);
+        add_possible_root(raw_jmp_buf[i], HeapRoot { .type = HeapRoot::Type::RegisterPointer });
 
     auto stack_reference = bit_cast<FlatPtr>(&dummy);
 
     for (FlatPtr stack_address = stack_reference; stack_address < m_stack_info.top(); stack_address += sizeof(FlatPtr)) {
         auto data = *reinterpret_cast<FlatPtr*>(stack_address);
-        add_possible_value(possible_pointers, data, HeapRoot { .type = HeapRoot::Type::StackPointer }, min_block_address, max_block_address);
-        gather_asan_fake_stack_roots(possible_pointers, data, min_block_address, max_block_address);
+        add_possible_root(data, HeapRoot { .type = HeapRoot::Type::StackPointer });
+        for_each_asan_fake_stack_value(data, [&](FlatPtr fake_stack_data) {
+            add_possible_root(fake_stack_data, HeapRoot { .type = HeapRoot::Type::StackPointer });
+        });
     }
 
     for (auto& vector : m_conservative_vectors) {
         for (auto possible_value : vector.possible_values()) {
-            add_possible_value(possible_pointers, possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector }, min_block_address, max_block_address);
+            add_possible_root(possible_value, HeapRoot { .type = HeapRoot::Type::ConservativeVector });
         }
     }
-
-    HashTable<HeapBlock*> all_live_heap_blocks;
-    for_each_block([&](auto& block) {
-        all_live_heap_blocks.set(&block);
-        return IterationDecision::Continue;
-    });
-
-    for_each_cell_among_possible_pointers(all_live_heap_blocks, possible_pointers, [&](Cell* cell, FlatPtr possible_pointer) {
-        if (cell->state() == Cell::State::Live) {
-            dbgln_if(HEAP_DEBUG, "  ?-> {}", (void const*)cell);
-            roots.set(cell, *possible_pointers.get(possible_pointer));
-        } else {
-            dbgln_if(HEAP_DEBUG, "  #-> {}", (void const*)cell);
-        }
-    });
 }
 
-class MarkingVisitor final : public Cell::Visitor {
+class MarkingVisitor final
+    : public Cell::Visitor
+    , public RootCollector {
 public:
-    explicit MarkingVisitor(Heap& heap, HashMap<Cell*, HeapRoot> const& roots)
+    explicit MarkingVisitor(Heap& heap)
         : m_heap(heap)
     {
         m_heap.find_min_and_max_block_addresses(m_min_block_address, m_max_block_address);
@@ -477,10 +622,13 @@ public:
             m_all_live_heap_blocks.set(&block);
             return IterationDecision::Continue;
         });
+    }
 
-        for (auto* root : roots.keys()) {
-            visit(root);
-        }
+    // Roots go straight onto the mark stack, we don't care where they came from here.
+    virtual void add_root(Cell* cell, HeapRoot) override
+    {
+        dbgln_if(HEAP_DEBUG, "  + {}", cell);
+        visit(cell);
     }
 
     virtual void visit_impl(Cell& cell) override
@@ -526,11 +674,12 @@ private:
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::mark_live_cells()
 {
-    dbgln_if(HEAP_DEBUG, "mark_live_cells:");
+    MarkingVisitor visitor(*this);
+    gather_roots(visitor);
 
-    MarkingVisitor visitor(*this, roots);
+    dbgln_if(HEAP_DEBUG, "mark_live_cells:");
     visitor.mark_all_live_cells();
 
     for (auto& inverse_root : m_uprooted_cells)
@@ -585,7 +734,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     size_t live_cell_bytes = 0;
 
     for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+        size_t block_live_cells = 0;
         bool block_was_full = block.is_full();
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked()) {
@@ -595,11 +744,13 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
                 collected_cell_bytes += block.cell_size();
             } else {
                 cell->set_marked(false);
-                block_has_live_cells = true;
+                ++block_live_cells;
                 ++live_cells;
                 live_cell_bytes += block.cell_size();
             }
         });
+        block.set_live_cell_count_at_last_sweep({}, block_live_cells);
+        bool block_has_live_cells = block_live_cells > 0;
         if (!block_has_live_cells)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
@@ -620,6 +771,9 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.sort_usable_blocks_by_occupancy({});
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
@@ -627,7 +781,7 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    m_live_cell_bytes_after_last_gc = live_cell_bytes;
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
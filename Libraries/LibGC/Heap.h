@@ -11,8 +11,10 @@
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/Optional.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
@@ -35,7 +37,7 @@ class GC_API Heap {
     AK_MAKE_NONMOVABLE(Heap);
 
 public:
-    explicit Heap(AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> gather_embedder_roots);
+    explicit Heap(AK::Function<void(RootCollector&)> gather_embedder_roots);
     ~Heap();
 
     static Heap& the();
@@ -58,6 +60,31 @@ public:
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
     AK::JsonObject dump_graph();
 
+    // Lets the embedder get ahead of the allocation-triggered collection while it has nothing better to do.
+    // Returns true if a collection was performed.
+    bool collect_garbage_during_idle_time(AK::Duration available_time);
+
+    struct Statistics {
+        size_t collection_count { 0 };
+        size_t idle_collection_count { 0 };
+        AK::Duration last_mark_duration;
+        AK::Duration total_mark_duration;
+        AK::Duration last_collection_duration;
+        AK::Duration total_collection_duration;
+    };
+    Statistics const& statistics() const { return m_statistics; }
+
+    // The embedder can set a budget that the heap should try to stay under, e.g. to cap the footprint of a tab.
+    // Zero means there is no budget.
+    size_t memory_budget() const { return m_memory_budget; }
+    void set_memory_budget(size_t);
+
+    enum class MemoryPressure : u8 {
+        Moderate,
+        Critical,
+    };
+    void did_receive_memory_pressure(MemoryPressure);
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -113,11 +140,13 @@ private:
 
     void will_allocate(size_t);
 
+    void adjust_heap_growth_factor(AK::Duration mutator_cpu_time, AK::Duration collection_cpu_time);
+    void update_gc_bytes_threshold();
+
     void find_min_and_max_block_addresses(FlatPtr& min_address, FlatPtr& max_address);
-    void gather_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
-    void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
+    void gather_roots(RootCollector&);
+    void gather_conservative_roots(RootCollector&);
+    void mark_live_cells();
     void finalize_unmarked_cells();
     void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
     void sweep_weak_blocks();
@@ -146,9 +175,19 @@ private:
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
+    size_t m_live_cell_bytes_after_last_gc { 0 };
+    size_t m_memory_budget { 0 };
+
+    // The next collection is triggered once the heap has grown by this factor of the live bytes after the last one.
+    static constexpr double GC_MIN_HEAP_GROWTH_FACTOR { 1.0 };
+    static constexpr double GC_MAX_HEAP_GROWTH_FACTOR { 4.0 };
+    double m_heap_growth_factor { GC_MIN_HEAP_GROWTH_FACTOR };
+    Optional<AK::Duration> m_cpu_time_at_last_collection_end;
 
     bool m_should_collect_on_every_allocation { false };
 
+    Statistics m_statistics;
+
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
     CellAllocator::List m_all_cell_allocators;
 
@@ -165,7 +204,7 @@ private:
 
     bool m_collecting_garbage { false };
     StackInfo m_stack_info;
-    AK::Function<void(HashMap<Cell*, GC::HeapRoot>&)> m_gather_embedder_roots;
+    AK::Function<void(RootCollector&)> m_gather_embedder_roots;
 
     Vector<AK::Function<void()>> m_post_gc_tasks;
 
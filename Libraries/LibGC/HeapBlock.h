@@ -50,6 +50,9 @@ public:
 
     void deallocate(Cell*);
 
+    size_t live_cell_count_at_last_sweep() const { return m_live_cell_count_at_last_sweep; }
+    void set_live_cell_count_at_last_sweep(Badge<Heap>, size_t count) { m_live_cell_count_at_last_sweep = count; }
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -111,6 +114,7 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    size_t m_live_cell_count_at_last_sweep { 0 };
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/SourceLocation.h>
+#include <LibGC/Forward.h>
 
 namespace GC {
 
@@ -27,4 +28,14 @@ struct GC_API HeapRoot {
     SourceLocation const* location { nullptr };
 };
 
+// Receives the roots found while gathering roots. Collections mark them as they come in, while heap graph dumps
+// also keep track of where each root came from.
+class GC_API RootCollector {
+public:
+    virtual void add_root(Cell*, HeapRoot) = 0;
+
+protected:
+    virtual ~RootCollector() = default;
+};
+
 }
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <AK/Badge.h>
 #include <AK/Types.h>
 #include <LibGC/Export.h>
 #include <LibGC/Forward.h>
@@ -26,6 +27,11 @@ public:
 
     Heap& heap() { return m_heap; }
 
+    // Set once any cell in this block opts into must_survive_garbage_collection(), so root gathering
+    // can skip the (vast majority of) blocks that never contain such cells.
+    bool has_cells_overriding_must_survive_garbage_collection() const { return m_has_cells_overriding_must_survive_garbage_collection; }
+    void did_create_cell_overriding_must_survive_garbage_collection(Badge<Cell>) { m_has_cells_overriding_must_survive_garbage_collection = true; }
+
 protected:
     HeapBlockBase(Heap& heap)
         : m_heap(heap)
@@ -33,6 +39,7 @@ protected:
     }
 
     Heap& m_heap;
+    bool m_has_cells_overriding_must_survive_garbage_collection { false };
 };
 
 }
@@ -17,7 +17,7 @@ namespace GC {
 
 class GC_API RootHashMapBase {
 public:
-    virtual void gather_roots(HashMap<Cell*, GC::HeapRoot>&) const = 0;
+    virtual void gather_roots(RootCollector&) const = 0;
 
 protected:
     explicit RootHashMapBase(Heap&);
@@ -47,14 +47,14 @@ public:
 
     ~RootHashMap() = default;
 
-    virtual void gather_roots(HashMap<Cell*, GC::HeapRoot>& roots) const override
+    virtual void gather_roots(RootCollector& roots) const override
     {
         for (auto& [key, value] : *this) {
             if constexpr (IsBaseOf<NanBoxedValue, V>) {
                 if (value.is_cell())
-                    roots.set(&const_cast<V&>(value).as_cell(), HeapRoot { .type = HeapRoot::Type::RootHashMap });
+                    roots.add_root(&const_cast<V&>(value).as_cell(), HeapRoot { .type = HeapRoot::Type::RootHashMap });
             } else {
-                roots.set(value, HeapRoot { .type = HeapRoot::Type::RootHashMap });
+                roots.add_root(value, HeapRoot { .type = HeapRoot::Type::RootHashMap });
             }
         }
     }
@@ -18,7 +18,7 @@ namespace GC {
 
 class GC_API RootVectorBase {
 public:
-    virtual void gather_roots(HashMap<Cell*, GC::HeapRoot>&) const = 0;
+    virtual void gather_roots(RootCollector&) const = 0;
 
 protected:
     explicit RootVectorBase(Heap&);
@@ -83,14 +83,14 @@ public:
         return *this;
     }
 
-    virtual void gather_roots(HashMap<Cell*, GC::HeapRoot>& roots) const override
+    virtual void gather_roots(RootCollector& roots) const override
     {
         for (auto& value : *this) {
             if constexpr (IsBaseOf<NanBoxedValue, T>) {
                 if (value.is_cell())
-                    roots.set(&const_cast<T&>(value).as_cell(), HeapRoot { .type = HeapRoot::Type::RootVector });
+                    roots.add_root(&const_cast<T&>(value).as_cell(), HeapRoot { .type = HeapRoot::Type::RootVector });
             } else {
-                roots.set(value, HeapRoot { .type = HeapRoot::Type::RootVector });
+                roots.add_root(value, HeapRoot { .type = HeapRoot::Type::RootVector });
             }
         }
     }
@@ -6,6 +6,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/NeverDestroyed.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
@@ -140,6 +141,102 @@ SkFont Font::skia_font(float scale) const
     return sk_font;
 }
 
+struct ShapingCacheState {
+    Font::ShapingCache::LRUList lru_list;
+    Font::ShapingCache::Statistics statistics;
+    size_t byte_budget { Font::ShapingCache::default_byte_budget };
+};
+
+// NOTE: Fonts can outlive any static destructor, so the shared state is never destroyed.
+static NeverDestroyed<ShapingCacheState> s_shaping_cache_state;
+
+Font::ShapingCache::Statistics const& Font::ShapingCache::statistics()
+{
+    return s_shaping_cache_state->statistics;
+}
+
+size_t Font::ShapingCache::byte_budget()
+{
+    return s_shaping_cache_state->byte_budget;
+}
+
+void Font::ShapingCache::set_byte_budget(size_t byte_budget)
+{
+    s_shaping_cache_state->byte_budget = byte_budget;
+    evict_least_recently_used_entries(0);
+}
+
+void Font::ShapingCache::evict_least_recently_used_entries(size_t bytes_needed)
+{
+    auto& state = *s_shaping_cache_state;
+    while (state.statistics.byte_count + bytes_needed > state.byte_budget && !state.lru_list.is_empty()) {
+        auto& least_recently_used = *state.lru_list.last();
+        least_recently_used.cache->evict(least_recently_used);
+    }
+}
+
+unsigned Font::ShapingCache::hash(Utf16View const& text, ShapeFeatures const& features)
+{
+    auto hash = text.hash();
+    for (auto const& feature : features) {
+        auto tag = (static_cast<u32>(feature.tag[0]) << 24) | (static_cast<u32>(feature.tag[1]) << 16) | (static_cast<u32>(feature.tag[2]) << 8) | static_cast<u32>(feature.tag[3]);
+        hash = pair_int_hash(hash, pair_int_hash(tag, feature.value));
+    }
+    return hash;
+}
+
+hb_buffer_t* Font::ShapingCache::find(Utf16View const& text, ShapeFeatures const& features)
+{
+    auto& state = *s_shaping_cache_state;
+    auto it = map.find(hash(text, features), [&](auto& candidate) {
+        return candidate.key.features == features && candidate.key.text == text;
+    });
+    if (it == map.end()) {
+        ++state.statistics.miss_count;
+        return nullptr;
+    }
+    ++state.statistics.hit_count;
+    state.lru_list.prepend(*it->value);
+    return it->value->buffer;
+}
+
+void Font::ShapingCache::set(Utf16View const& text, ShapeFeatures const& features, hb_buffer_t* buffer)
+{
+    auto& state = *s_shaping_cache_state;
+
+    auto entry = make<Entry>();
+    entry->cache = this;
+    entry->buffer = buffer;
+    entry->hash = hash(text, features);
+    entry->byte_size = sizeof(Entry)
+        + text.length_in_code_units() * sizeof(char16_t)
+        + hb_buffer_get_length(buffer) * (sizeof(hb_glyph_info_t) + sizeof(hb_glyph_position_t));
+
+    // Make room before inserting, so the buffer we're about to hand out is never the one that gets evicted.
+    evict_least_recently_used_entries(entry->byte_size);
+
+    state.statistics.byte_count += entry->byte_size;
+    ++state.statistics.entry_count;
+    state.lru_list.prepend(*entry);
+    map.set(Key { features, Utf16String::from_utf16(text) }, move(entry));
+}
+
+void Font::ShapingCache::evict(Entry& entry)
+{
+    auto& statistics = s_shaping_cache_state->statistics;
+    statistics.byte_count -= entry.byte_size;
+    --statistics.entry_count;
+    ++statistics.eviction_count;
+    hb_buffer_destroy(entry.buffer);
+
+    // The entry is owned by the map, so it has to leave the shared LRU list before the map destroys it.
+    entry.lru_list_node.remove();
+
+    auto it = map.find(entry.hash, [&](auto& candidate) { return candidate.value.ptr() == &entry; });
+    VERIFY(it != map.end());
+    map.remove(it);
+}
+
 Font::ShapingCache::~ShapingCache()
 {
     clear();
@@ -147,8 +244,12 @@ Font::ShapingCache::~ShapingCache()
 
 void Font::ShapingCache::clear()
 {
+    auto& statistics = s_shaping_cache_state->statistics;
     for (auto& it : map) {
-        hb_buffer_destroy(it.value);
+        statistics.byte_count -= it.value->byte_size;
+        --statistics.entry_count;
+        hb_buffer_destroy(it.value->buffer);
+        it.value->lru_list_node.remove();
     }
     map.clear();
     for (auto& buffer : single_ascii_character_map) {
@@ -157,6 +258,7 @@ void Font::ShapingCache::clear()
             buffer = nullptr;
         }
     }
+    single_ascii_character_features.clear();
 }
 
 static bool hb_face_has_table(hb_face_t* face, hb_tag_t tag)
@@ -10,6 +10,9 @@
 #pragma once
 
 #include <AK/FlyString.h>
+#include <AK/HashMap.h>
+#include <AK/IntrusiveList.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/Utf16String.h>
 #include <LibGfx/Font/Font.h>
 #include <LibGfx/Font/Typeface.h>
@@ -83,15 +86,60 @@ public:
     Font const& bold_variant() const;
     hb_font_t* harfbuzz_font() const;
 
+    // Caches shaped text per font, keyed by the text and the features it was shaped with. The caches of all fonts share
+    // a byte budget, and the least recently used entries are evicted once it is exceeded.
     struct ShapingCache {
-        // Before using the cache, make sure the features match! If they don't, clear the cache.
-        ShapeFeatures features;
-
-        HashMap<Utf16String, hb_buffer_t*> map;
+        struct Key {
+            ShapeFeatures features;
+            Utf16String text;
+        };
+
+        struct KeyTraits : public DefaultTraits<Key> {
+            static unsigned hash(Key const& key) { return ShapingCache::hash(key.text, key.features); }
+            static bool equals(Key const& a, Key const& b) { return a.features == b.features && a.text == b.text; }
+        };
+
+        struct Entry {
+            ShapingCache* cache { nullptr };
+            hb_buffer_t* buffer { nullptr };
+            unsigned hash { 0 };
+            size_t byte_size { 0 };
+            IntrusiveListNode<Entry> lru_list_node;
+        };
+        using LRUList = IntrusiveList<&Entry::lru_list_node>;
+
+        struct Statistics {
+            size_t hit_count { 0 };
+            size_t miss_count { 0 };
+            size_t eviction_count { 0 };
+            size_t entry_count { 0 };
+            size_t byte_count { 0 };
+        };
+        static Statistics const& statistics();
+
+        static constexpr size_t default_byte_budget = 16 * MiB;
+        static size_t byte_budget();
+        // Only meant for tests, which need to go through eviction without shaping 16 MiB worth of text.
+        static void set_byte_budget(size_t);
+
+        static unsigned hash(Utf16View const&, ShapeFeatures const&);
+
+        hb_buffer_t* find(Utf16View const&, ShapeFeatures const&);
+        void set(Utf16View const&, ShapeFeatures const&, hb_buffer_t*);
+
+        HashMap<Key, NonnullOwnPtr<Entry>, KeyTraits> map;
+
+        // Single ASCII characters are common enough to get a fixed table outside the budget. It only holds characters
+        // shaped with the first set of features seen, the rest go through the map.
+        Optional<ShapeFeatures> single_ascii_character_features;
         hb_buffer_t* single_ascii_character_map[128] { nullptr };
 
         ~ShapingCache();
         void clear();
+
+    private:
+        static void evict_least_recently_used_entries(size_t bytes_needed);
+        void evict(Entry&);
     };
     ShapingCache& shaping_cache() const { return m_shaping_cache; }
 
@@ -104,17 +104,12 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
     auto const& metrics = font.pixel_metrics();
     auto& shaping_cache = font.shaping_cache();
 
-    // NOTE: We only cache shaping results for a specific set of features. If the features change, we clear the cache.
-    if (shaping_cache.features != features) {
-        shaping_cache.clear();
-        shaping_cache.features = features;
-    }
-
-    // FIXME: The cache currently grows unbounded. We should have some limit and LRU mechanism.
     auto get_or_create_buffer = [&] -> hb_buffer_t* {
         if (string.length_in_code_units() == 1) {
             auto code_unit = string.code_unit_at(0);
-            if (code_unit < 128) {
+            if (!shaping_cache.single_ascii_character_features.has_value())
+                shaping_cache.single_ascii_character_features = features;
+            if (code_unit < 128 && shaping_cache.single_ascii_character_features == features) {
                 auto*& cache_slot = shaping_cache.single_ascii_character_map[code_unit];
                 if (!cache_slot) {
                     cache_slot = setup_text_shaping(string, font, features);
@@ -122,13 +117,10 @@ NonnullRefPtr<GlyphRun> shape_text(FloatPoint baseline_start, float letter_spaci
                 return cache_slot;
             }
         }
-        if (auto it = shaping_cache.map.find(
-                string.hash(), [&](auto& candidate) { return candidate.key == string; });
-            it != shaping_cache.map.end()) {
-            return it->value;
-        }
+        if (auto* buffer = shaping_cache.find(string, features))
+            return buffer;
         auto* buffer = setup_text_shaping(string, font, features);
-        shaping_cache.map.set(Utf16String::from_utf16(string), buffer);
+        shaping_cache.set(string, features, buffer);
         return buffer;
     };
 
@@ -93,8 +93,6 @@ void Executable::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(constants);
-    for (auto& cache : template_object_caches)
-        visitor.visit(cache.cached_template_object);
 }
 
 Optional<Executable::ExceptionHandlers const&> Executable::exception_handlers_for_offset(size_t offset) const
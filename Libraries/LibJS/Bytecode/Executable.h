@@ -71,9 +71,15 @@ struct GlobalVariableCache : public PropertyLookupCache {
 };
 
 // https://tc39.es/ecma262/#sec-gettemplateobject
-// Template objects are cached at the call site.
+// Template objects are cached at the call site. The realm's [[TemplateMap]] is what keeps them alive.
 struct TemplateObjectCache {
-    GC::Ptr<Array> cached_template_object;
+    GC::Weak<Array> cached_template_object;
+};
+
+// The caches of an executable that refer to the objects of a specific realm.
+struct RealmSpecificCaches {
+    Vector<GlobalVariableCache> global_variable_caches;
+    Vector<TemplateObjectCache> template_object_caches;
 };
 
 struct SourceRecord {
@@ -107,6 +113,12 @@ public:
     Vector<PropertyLookupCache> property_lookup_caches;
     Vector<GlobalVariableCache> global_variable_caches;
     Vector<TemplateObjectCache> template_object_caches;
+
+    // The ProgramCache can share parse trees, and with them executables, between realms. The global variable and
+    // template object caches above belong to the first realm that ran this executable, and every other realm uses
+    // its own copies from Realm::caches_for_shared_executable(). This is only ever compared, never dereferenced.
+    Realm const* realm_of_caches { nullptr };
+
     NonnullOwnPtr<StringTable> string_table;
     NonnullOwnPtr<IdentifierTable> identifier_table;
     NonnullOwnPtr<PropertyKeyTable> property_key_table;
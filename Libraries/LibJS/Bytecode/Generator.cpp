@@ -18,6 +18,9 @@
 
 namespace JS::Bytecode {
 
+bool g_optimize_bytecode = true;
+bool g_dump_bytecode_pass_statistics = false;
+
 Generator::Generator(VM& vm, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled)
     : m_vm(vm)
     , m_string_table(make<StringTable>())
@@ -218,6 +221,77 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(S
     return {};
 }
 
+static size_t instruction_count(ReadonlyBytes instruction_stream)
+{
+    size_t count = 0;
+    for (InstructionStreamIterator it(instruction_stream); !it.at_end(); ++it)
+        ++count;
+    return count;
+}
+
+static Optional<Label> unconditional_jump_target(BasicBlock const& block)
+{
+    if (block.size() == 0)
+        return {};
+    auto const& instruction = *InstructionStreamIterator { block.instruction_stream() };
+    if (instruction.type() != Instruction::Type::Jump)
+        return {};
+    return static_cast<Op::Jump const&>(instruction).target();
+}
+
+// Retarget every label that points at a block consisting of nothing but a Jump to that Jump's target.
+static void thread_jumps(Vector<NonnullOwnPtr<BasicBlock>>& basic_blocks)
+{
+    for (auto& block : basic_blocks) {
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                // NOTE: The number of hops is bounded so that we don't get stuck on a cycle of empty blocks, e.g. `for (;;) {}`.
+                for (size_t hops = 0; hops < basic_blocks.size(); ++hops) {
+                    auto target = unconditional_jump_target(*basic_blocks[label.basic_block_index()]);
+                    if (!target.has_value() || target->basic_block_index() == label.basic_block_index())
+                        break;
+                    label = *target;
+                }
+            });
+        }
+    }
+}
+
+// A block is reachable if it's the entry block, a jump target of a reachable block, or the handler or finalizer
+// of a reachable block.
+static Vector<bool> find_reachable_blocks(Vector<NonnullOwnPtr<BasicBlock>> const& basic_blocks)
+{
+    Vector<bool> is_reachable;
+    is_reachable.resize(basic_blocks.size());
+
+    Vector<BasicBlock const*> worklist;
+    auto mark_reachable = [&](BasicBlock const& block) {
+        if (is_reachable[block.index()])
+            return;
+        is_reachable[block.index()] = true;
+        worklist.append(&block);
+    };
+
+    mark_reachable(*basic_blocks.first());
+    while (!worklist.is_empty()) {
+        auto const& block = *worklist.take_last();
+        if (block.handler())
+            mark_reachable(*block.handler());
+        if (block.finalizer())
+            mark_reachable(*block.finalizer());
+
+        for (InstructionStreamIterator it(block.instruction_stream()); !it.at_end(); ++it) {
+            auto& instruction = const_cast<Instruction&>(*it);
+            instruction.visit_labels([&](Label& label) {
+                mark_reachable(*basic_blocks[label.basic_block_index()]);
+            });
+        }
+    }
+
+    return is_reachable;
+}
+
 CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<SharedFunctionInstanceData const> shared_function_instance_data, MustPropagateCompletion must_propagate_completion, BuiltinAbstractOperationsEnabled builtin_abstract_operations_enabled, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, shared_function_instance_data, must_propagate_completion, builtin_abstract_operations_enabled);
@@ -270,9 +344,39 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         }
     }
 
+    size_t instruction_count_before_passes = 0;
+    if (g_dump_bytecode_pass_statistics) {
+        for (auto& block : generator.m_root_basic_blocks)
+            instruction_count_before_passes += instruction_count(block->instruction_stream());
+    }
+
+    Vector<bool> block_is_reachable;
+    if (g_optimize_bytecode) {
+        // Pass: Thread jumps through empty blocks, so that they become unreachable.
+        thread_jumps(generator.m_root_basic_blocks);
+
+        // Pass: Drop blocks that are unreachable from the entry block.
+        block_is_reachable = find_reachable_blocks(generator.m_root_basic_blocks);
+    } else {
+        block_is_reachable.resize(generator.m_root_basic_blocks.size());
+        block_is_reachable.fill(true);
+    }
+
+    auto index_of_next_reachable_block = [&](BasicBlock const& block) {
+        auto index = block.index() + 1;
+        while (index < block_is_reachable.size() && !block_is_reachable[index])
+            ++index;
+        return index;
+    };
+
+    size_t instruction_count_after_unreachable_block_elimination = 0;
     size_t size_needed = 0;
     for (auto& block : generator.m_root_basic_blocks) {
+        if (!block_is_reachable[block->index()])
+            continue;
         size_needed += block->size();
+        if (g_dump_bytecode_pass_statistics)
+            instruction_count_after_unreachable_block_elimination += instruction_count(block->instruction_stream());
     }
 
     Vector<u8> bytecode;
@@ -343,6 +447,9 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
     for (auto& block : generator.m_root_basic_blocks) {
+        if (!block_is_reachable[block->index()])
+            continue;
+
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
             unlinked_exception_handlers.append({
@@ -355,19 +462,46 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
 
         block_offsets.set(block.ptr(), bytecode.size());
 
-        for (auto& [offset, source_record] : block->source_map()) {
-            source_map.set(bytecode.size() + offset, source_record);
-        }
+        auto next_block_index = index_of_next_reachable_block(*block);
 
         Bytecode::InstructionStreamIterator it(block->instruction_stream());
         while (!it.at_end()) {
             auto& instruction = const_cast<Instruction&>(*it);
 
+            // NOTE: Instructions may be dropped or replaced below, so the source map is rebuilt one instruction at a time.
+            if (auto source_record = block->source_map().get(it.offset()); source_record.has_value())
+                source_map.set(bytecode.size(), source_record.release_value());
+
+            // OPTIMIZATION: Don't emit moves from an operand to itself.
+            if (g_optimize_bytecode && instruction.type() == Instruction::Type::Mov) {
+                auto& mov = static_cast<Bytecode::Op::Mov&>(instruction);
+                if (mov.dst() == mov.src()) {
+                    ++it;
+                    continue;
+                }
+            }
+
+            // OPTIMIZATION: A `JumpIf` whose targets are the same block (e.g. after jump threading) is an unconditional jump.
+            if (g_optimize_bytecode && instruction.type() == Instruction::Type::JumpIf) {
+                auto& jump = static_cast<Bytecode::Op::JumpIf&>(instruction);
+                if (jump.true_target().basic_block_index() == jump.false_target().basic_block_index()) {
+                    if (jump.true_target().basic_block_index() != next_block_index) {
+                        Op::Jump unconditional_jump(Label { jump.true_target() });
+                        auto& label = unconditional_jump.target();
+                        size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&unconditional_jump));
+                        label_offsets.append(label_offset);
+                        bytecode.append(reinterpret_cast<u8 const*>(&unconditional_jump), unconditional_jump.length());
+                    }
+                    ++it;
+                    continue;
+                }
+            }
+
             if (instruction.type() == Instruction::Type::Jump) {
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
                 // OPTIMIZATION: Don't emit jumps that just jump to the next block.
-                if (jump.target().basic_block_index() == block->index() + 1) {
+                if (jump.target().basic_block_index() == next_block_index) {
                     if (basic_block_start_offsets.last() == bytecode.size()) {
                         // This block is empty, just skip it.
                         basic_block_start_offsets.take_last();
@@ -404,7 +538,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
             //               we can emit a `JumpTrue` or `JumpFalse` (to the other block) instead.
             if (instruction.type() == Instruction::Type::JumpIf) {
                 auto& jump = static_cast<Bytecode::Op::JumpIf&>(instruction);
-                if (jump.true_target().basic_block_index() == block->index() + 1) {
+                if (jump.true_target().basic_block_index() == next_block_index) {
                     Op::JumpFalse jump_false(jump.condition(), Label { jump.false_target() });
                     auto& label = jump_false.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_false));
@@ -413,7 +547,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                     ++it;
                     continue;
                 }
-                if (jump.false_target().basic_block_index() == block->index() + 1) {
+                if (jump.false_target().basic_block_index() == next_block_index) {
                     Op::JumpTrue jump_true(jump.condition(), Label { jump.true_target() });
                     auto& label = jump_true.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_true));
@@ -445,6 +579,13 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         label.set_address(block_offsets.get(block).value());
     }
 
+    if (g_dump_bytecode_pass_statistics) {
+        auto final_instruction_count = instruction_count(bytecode.span());
+        dbgln("Bytecode pass statistics:");
+        dbgln("  Jump threading and unreachable block elimination: {} -> {} instructions", instruction_count_before_passes, instruction_count_after_unreachable_block_elimination);
+        dbgln("  Peephole optimization: {} -> {} instructions", instruction_count_after_unreachable_block_elimination, final_instruction_count);
+    }
+
     auto executable = vm.heap().allocate<Executable>(
         move(bytecode),
         move(generator.m_identifier_table),
@@ -1381,8 +1522,9 @@ void Generator::emit_jump_if(ScopedOperand const& condition, Label true_target,
 {
     if (condition.operand().is_constant()) {
         auto value = m_constants[condition.operand().index()];
-        if (value.is_boolean()) {
-            if (value.as_bool()) {
+        // NOTE: ToBoolean() has no side effects for these, so we can decide the branch right away.
+        if (value.is_boolean() || value.is_number() || value.is_nullish() || value.is_string()) {
+            if (value.to_boolean()) {
                 emit<Op::Jump>(true_target);
             } else {
                 emit<Op::Jump>(false_target);
@@ -19,6 +19,7 @@
 #include <LibJS/Bytecode/PutKind.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Bytecode/StringTable.h>
+#include <LibJS/Export.h>
 #include <LibJS/Forward.h>
 #include <LibJS/Runtime/FunctionKind.h>
 #include <LibRegex/Regex.h>
@@ -447,4 +448,7 @@ private:
     Optional<PropertyKeyTableIndex> m_length_identifier;
 };
 
+JS_API extern bool g_optimize_bytecode;
+JS_API extern bool g_dump_bytecode_pass_statistics;
+
 }
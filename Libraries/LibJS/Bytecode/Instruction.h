@@ -17,7 +17,6 @@ namespace JS::Bytecode::Op {
 
 #define JS_ENUMERATE_COMMON_BINARY_OPS_WITHOUT_FAST_PATH(O) \
     O(Exp, exp)                                             \
-    O(Mod, mod)                                             \
     O(In, in)                                               \
     O(InstanceOf, instance_of)                              \
     O(LooselyInequals, loosely_inequals)                    \
@@ -25,11 +24,6 @@ namespace JS::Bytecode::Op {
     O(StrictlyInequals, strict_inequals)                    \
     O(StrictlyEquals, strict_equals)
 
-#define JS_ENUMERATE_COMMON_UNARY_OPS(O) \
-    O(BitwiseNot, bitwise_not)           \
-    O(UnaryPlus, unary_plus)             \
-    O(UnaryMinus, unary_minus)
-
 #define JS_ENUMERATE_COMPARISON_OPS(X)            \
     X(LessThan, less_than, <)                     \
     X(LessThanEquals, less_than_equals, <=)       \
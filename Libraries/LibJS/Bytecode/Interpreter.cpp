@@ -652,6 +652,17 @@ ThrowCompletionOr<Value> Interpreter::run_executable(ExecutionContext& context,
     context.identifier_table = executable.identifier_table->identifiers().data();
     context.property_key_table = executable.property_key_table->property_keys().data();
 
+    if (!executable.realm_of_caches)
+        executable.realm_of_caches = &realm();
+    if (executable.realm_of_caches == &realm()) [[likely]] {
+        context.global_variable_caches = executable.global_variable_caches.data();
+        context.template_object_caches = executable.template_object_caches.data();
+    } else {
+        auto& caches = realm().caches_for_shared_executable(executable);
+        context.global_variable_caches = caches.global_variable_caches.data();
+        context.template_object_caches = caches.template_object_caches.data();
+    }
+
     ASSERT(executable.registers_and_constants_and_locals_count <= context.registers_and_constants_and_locals_and_arguments_span().size());
 
     // NOTE: We only copy the `this` value from ExecutionContext if it's not already set.
@@ -753,6 +764,8 @@ ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM& vm, GC::Ref<SharedF
 {
     auto const& name = shared_function_instance_data->m_name;
 
+    const_cast<SharedFunctionInstanceData&>(*shared_function_instance_data).ensure_function_declaration_instantiation_is_analyzed();
+
     auto executable_result = Bytecode::Generator::generate_from_function(vm, shared_function_instance_data, builtin_abstract_operations_enabled);
     if (executable_result.is_error()) [[unlikely]]
         return vm.throw_completion<InternalError>(ErrorType::NotImplemented, TRY_OR_THROW_OOM(vm, executable_result.error().to_string()));
@@ -1081,13 +1094,10 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
         if (storage
             && storage->is_simple_storage()
             && !object.may_interfere_with_indexed_property_access()) {
-            auto maybe_value = storage->get(index);
-            if (maybe_value.has_value()) {
-                auto existing_value = maybe_value->value;
-                if (!existing_value.is_accessor()) {
-                    storage->put(index, value);
-                    return {};
-                }
+            auto& simple_storage = static_cast<SimpleIndexedPropertyStorage&>(*storage);
+            if (simple_storage.inline_has_index(index) && !simple_storage.elements()[index].is_accessor()) {
+                simple_storage.put(index, value);
+                return {};
             }
         }
 
@@ -1594,6 +1604,27 @@ ThrowCompletionOr<void> Sub::execute_impl(Bytecode::Interpreter& interpreter) co
     return {};
 }
 
+ThrowCompletionOr<void> Mod::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const lhs = interpreter.get(m_lhs);
+    auto const rhs = interpreter.get(m_rhs);
+
+    // OPTIMIZATION: Fast path for Int32 values.
+    //               A negative dividend can produce -0, and a zero divisor produces NaN, so leave those to mod().
+    if (lhs.is_int32() && rhs.is_int32()) [[likely]] {
+        auto const dividend = lhs.as_i32();
+        auto const divisor = rhs.as_i32();
+        if (dividend >= 0 && divisor > 0) [[likely]] {
+            interpreter.set(m_dst, Value(dividend % divisor));
+            return {};
+        }
+    }
+
+    interpreter.set(m_dst, TRY(mod(vm, lhs, rhs)));
+    return {};
+}
+
 ThrowCompletionOr<void> BitwiseXor::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
@@ -1766,15 +1797,54 @@ void Not::execute_impl(Interpreter& interpreter) const
     interpreter.set(dst(), Value(!interpreter.get(src()).to_boolean()));
 }
 
-#define JS_DEFINE_COMMON_UNARY_OP(OpTitleCase, op_snake_case)                                   \
-    ThrowCompletionOr<void> OpTitleCase::execute_impl(Bytecode::Interpreter& interpreter) const \
-    {                                                                                           \
-        auto& vm = interpreter.vm();                                                            \
-        interpreter.set(dst(), TRY(op_snake_case(vm, interpreter.get(src()))));                 \
-        return {};                                                                              \
+ThrowCompletionOr<void> BitwiseNot::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const value = interpreter.get(src());
+
+    // OPTIMIZATION: Fast path for Int32 values.
+    if (value.is_int32()) [[likely]] {
+        interpreter.set(dst(), Value(~value.as_i32()));
+        return {};
+    }
+
+    interpreter.set(dst(), TRY(bitwise_not(vm, value)));
+    return {};
+}
+
+ThrowCompletionOr<void> UnaryPlus::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const value = interpreter.get(src());
+
+    // OPTIMIZATION: ToNumber() is the identity for Number values.
+    if (value.is_number()) [[likely]] {
+        interpreter.set(dst(), value);
+        return {};
     }
 
-JS_ENUMERATE_COMMON_UNARY_OPS(JS_DEFINE_COMMON_UNARY_OP)
+    interpreter.set(dst(), TRY(unary_plus(vm, value)));
+    return {};
+}
+
+ThrowCompletionOr<void> UnaryMinus::execute_impl(Bytecode::Interpreter& interpreter) const
+{
+    auto& vm = interpreter.vm();
+    auto const value = interpreter.get(src());
+
+    // OPTIMIZATION: Fast path for Int32 values.
+    //               Negating 0 produces -0, and negating INT32_MIN overflows, so leave those to unary_minus().
+    if (value.is_int32()) [[likely]] {
+        auto const integer_value = value.as_i32();
+        if (integer_value != 0 && integer_value != NumericLimits<i32>::min()) [[likely]] {
+            interpreter.set(dst(), Value(-integer_value));
+            return {};
+        }
+    }
+
+    interpreter.set(dst(), TRY(unary_minus(vm, value)));
+    return {};
+}
 
 void NewArray::execute_impl(Bytecode::Interpreter& interpreter) const
 {
@@ -1797,7 +1867,7 @@ void NewPrimitiveArray::execute_impl(Bytecode::Interpreter& interpreter) const
 void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
 {
     auto& vm = interpreter.vm();
-    auto& cache = interpreter.current_executable().template_object_caches[m_cache_index];
+    auto& cache = interpreter.running_execution_context().template_object_caches[m_cache_index];
 
     // 1. Let realm be the current Realm Record.
     auto& realm = *vm.current_realm();
@@ -1806,8 +1876,8 @@ void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
     // 3. For each element e of templateRegistry, do
     //    a. If e.[[Site]] is the same Parse Node as templateLiteral, then
     //       i. Return e.[[Array]].
-    if (cache.cached_template_object) {
-        interpreter.set(dst(), cache.cached_template_object);
+    if (auto cached_template_object = cache.cached_template_object.ptr()) {
+        interpreter.set(dst(), cached_template_object);
         return;
     }
 
@@ -1856,6 +1926,7 @@ void GetTemplateObject::execute_impl(Bytecode::Interpreter& interpreter) const
     MUST(template_object->set_integrity_level(Object::IntegrityLevel::Frozen));
 
     // 16. Append the Record { [[Site]]: templateLiteral, [[Array]]: template } to realm.[[TemplateMap]].
+    realm.add_to_template_map(template_object);
     cache.cached_template_object = template_object;
 
     // 17. Return template.
@@ -2032,7 +2103,7 @@ ThrowCompletionOr<void> GetCalleeAndThisFromEnvironment::execute_impl(Bytecode::
 
 ThrowCompletionOr<void> GetGlobal::execute_impl(Bytecode::Interpreter& interpreter) const
 {
-    interpreter.set(dst(), TRY(get_global(interpreter, m_identifier, strict(), interpreter.current_executable().global_variable_caches.data()[m_cache_index])));
+    interpreter.set(dst(), TRY(get_global(interpreter, m_identifier, strict(), interpreter.running_execution_context().global_variable_caches[m_cache_index])));
     return {};
 }
 
@@ -2042,7 +2113,7 @@ ThrowCompletionOr<void> SetGlobal::execute_impl(Bytecode::Interpreter& interpret
     auto& binding_object = interpreter.global_object();
     auto& declarative_record = interpreter.global_declarative_environment();
 
-    auto& cache = interpreter.current_executable().global_variable_caches.data()[m_cache_index];
+    auto& cache = interpreter.running_execution_context().global_variable_caches[m_cache_index];
     auto& shape = binding_object.shape();
     auto src = interpreter.get(m_src);
 
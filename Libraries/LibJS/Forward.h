@@ -213,6 +213,7 @@ class Parser;
 struct ParserError;
 class PrimitiveString;
 class Program;
+class ProgramCache;
 class PromiseCapability;
 class PromiseReaction;
 class PropertyAttributes;
@@ -336,12 +337,15 @@ class BasicBlock;
 enum class Builtin : u8;
 class Executable;
 class Generator;
+struct GlobalVariableCache;
 class Instruction;
 class Interpreter;
 class Operand;
 struct PropertyLookupCache;
+struct RealmSpecificCaches;
 class RegexTable;
 class Register;
+struct TemplateObjectCache;
 
 }
 
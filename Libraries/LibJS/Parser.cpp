@@ -779,7 +779,7 @@ bool Parser::parse_directive(ScopeNode& body)
 NonnullRefPtr<Program> Parser::parse_program(bool starts_in_strict_mode)
 {
     auto rule_start = push_start();
-    auto program = adopt_ref(*new Program({ m_source_code, rule_start.position(), position() }, m_program_type));
+    auto program = create_ast_node<Program>({ m_source_code, rule_start.position(), position() }, m_program_type);
     ScopePusher program_scope = ScopePusher::program_scope(*this, *program);
 
     if (m_program_type == Program::Type::Script)
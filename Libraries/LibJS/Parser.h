@@ -192,6 +192,9 @@ public:
     bool has_errors() const { return m_state.errors.size(); }
     Vector<ParserError> const& errors() const { return m_state.errors; }
 
+    // The combined size of the nodes in the parse tree. This doesn't include memory the nodes point to.
+    size_t parse_tree_node_bytes() const { return m_state.parse_tree_node_bytes; }
+
     struct TokenMemoization {
         bool try_parse_arrow_function_expression_failed;
     };
@@ -201,6 +204,13 @@ public:
 private:
     friend class ScopePusher;
 
+    template<class T, class... Args>
+    NonnullRefPtr<T> create_ast_node(SourceRange range, Args&&... args)
+    {
+        m_state.parse_tree_node_bytes += sizeof(T);
+        return JS::create_ast_node<T>(move(range), forward<Args>(args)...);
+    }
+
     void parse_script(Program& program, bool starts_in_strict_mode);
     void parse_module(Program& program);
 
@@ -314,6 +324,8 @@ private:
         bool in_class_static_init_block { false };
         bool function_might_need_arguments_object { false };
 
+        size_t parse_tree_node_bytes { 0 };
+
         ParserState(Lexer, Program::Type);
     };
 
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/ProgramCache.h>
+
+namespace JS {
+
+RefPtr<Program> ProgramCache::find(Program::Type type, StringView source_text, StringView filename, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_source_length)
+        return {};
+
+    auto source_text_hash = source_text.hash();
+
+    for (size_t i = 0; i < m_entries.size(); ++i) {
+        auto const& entry = m_entries[i];
+        if (entry.type != type || entry.source_text_hash != source_text_hash || entry.line_number_offset != line_number_offset)
+            continue;
+        if (entry.filename != filename || entry.source_text != source_text)
+            continue;
+
+        ++m_hit_count;
+        auto program = entry.program;
+
+        // Move the entry to the back, so that it's the last one to be evicted.
+        if (i != m_entries.size() - 1)
+            m_entries.append(m_entries.take(i));
+
+        return program;
+    }
+
+    ++m_miss_count;
+    return {};
+}
+
+void ProgramCache::add(Program::Type type, StringView source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program> program, size_t parse_tree_node_bytes)
+{
+    if (source_text.length() < minimum_source_length)
+        return;
+
+    // An entry keeps alive our copy of the source text and filename, the UTF-16 source code that the parse tree
+    // refers to, and the parse tree itself.
+    // FIXME: This doesn't account for the bytecode of functions in the parse tree, which is generated lazily.
+    auto memory_footprint = sizeof(Entry)
+        + source_text.length()
+        + filename.length()
+        + program->source_code().length_in_code_units() * sizeof(char16_t)
+        + parse_tree_node_bytes;
+    if (memory_footprint > maximum_memory_footprint)
+        return;
+
+    while (m_memory_footprint + memory_footprint > maximum_memory_footprint) {
+        m_memory_footprint -= m_entries.first().memory_footprint;
+        m_entries.remove(0);
+    }
+
+    m_memory_footprint += memory_footprint;
+    m_entries.append({
+        .type = type,
+        .source_text_hash = source_text.hash(),
+        .source_text = source_text,
+        .filename = filename,
+        .line_number_offset = line_number_offset,
+        .program = move(program),
+        .memory_footprint = memory_footprint,
+    });
+}
+
+void ProgramCache::clear()
+{
+    m_entries.clear();
+    m_memory_footprint = 0;
+}
+
+}
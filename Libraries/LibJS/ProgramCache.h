@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/Vector.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// Keeps the parse trees of recently parsed large scripts and modules around, so that parsing the exact same source
+// text again (e.g. when reloading a page, or when several documents load the same framework bundle) is free.
+// Since functions cache their SharedFunctionInstanceData on the parse tree, this also means their bytecode is reused.
+class JS_API ProgramCache {
+    AK_MAKE_NONCOPYABLE(ProgramCache);
+    AK_MAKE_NONMOVABLE(ProgramCache);
+
+public:
+    ProgramCache() = default;
+
+    // Sources smaller than this are cheap enough to parse that caching them isn't worth the memory.
+    static constexpr size_t minimum_source_length = 8 * KiB;
+    static constexpr size_t maximum_memory_footprint = 32 * MiB;
+
+    RefPtr<Program> find(Program::Type, StringView source_text, StringView filename, size_t line_number_offset);
+    void add(Program::Type, StringView source_text, StringView filename, size_t line_number_offset, NonnullRefPtr<Program>, size_t parse_tree_node_bytes);
+
+    void clear();
+
+    size_t memory_footprint() const { return m_memory_footprint; }
+
+    size_t hit_count() const { return m_hit_count; }
+    size_t miss_count() const { return m_miss_count; }
+
+private:
+    struct Entry {
+        Program::Type type;
+        unsigned source_text_hash { 0 };
+        ByteString source_text;
+        ByteString filename;
+        size_t line_number_offset { 0 };
+        NonnullRefPtr<Program> program;
+        size_t memory_footprint { 0 };
+    };
+
+    // Ordered from least to most recently used.
+    Vector<Entry> m_entries;
+    size_t m_memory_footprint { 0 };
+
+    size_t m_hit_count { 0 };
+    size_t m_miss_count { 0 };
+};
+
+}
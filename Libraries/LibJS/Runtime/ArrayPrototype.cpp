@@ -721,6 +721,28 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::for_each)
     return js_undefined();
 }
 
+// OPTIMIZATION: Reading the elements of an Array that:
+// - is not a proxy target, which means has/get will not trap.
+// - has intact prototype chain, which means holes can't be filled in by getters on the prototypes.
+// - has simple storage type, which means there are no accessors among the elements.
+// can't have side effects, so searches can look at the stored elements directly.
+static SimpleIndexedPropertyStorage const* simple_storage_for_search(Object& object)
+{
+    auto* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return static_cast<SimpleIndexedPropertyStorage const*>(storage);
+}
+
+// Storage that only holds numbers can't contain anything strictly equal to a non-number.
+static bool element_kind_may_contain(ElementKind element_kind, Value value)
+{
+    return element_kind == ElementKind::Any || value.is_number();
+}
+
 // 23.1.3.16 Array.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-array.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
 {
@@ -744,6 +766,23 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    if (auto const* storage = simple_storage_for_search(*this_object)) {
+        // NOTE: Holes, as well as indices past the end of a storage that shrunk while converting fromIndex, read as undefined.
+        if (!value_to_find.is_undefined() && !element_kind_may_contain(storage->element_kind(), value_to_find))
+            return Value(false);
+        auto const& elements = storage->elements();
+        auto end = min(length, storage->array_like_size());
+        for (u64 i = from_index; i < end; ++i) {
+            auto element = elements[i];
+            if (element.is_special_empty_value())
+                element = js_undefined();
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+        return Value(end < length && value_to_find.is_undefined());
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -797,6 +836,19 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    if (auto const* storage = simple_storage_for_search(*object)) {
+        if (!element_kind_may_contain(storage->element_kind(), search_element))
+            return Value(-1);
+        auto const& elements = storage->elements();
+        auto end = min(length, storage->array_like_size());
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (!element.is_special_empty_value() && is_strictly_equal(search_element, element))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -908,6 +960,18 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::last_index_of)
         k = (double)length + n;
     }
 
+    if (auto const* storage = simple_storage_for_search(*object)) {
+        if (!element_kind_may_contain(storage->element_kind(), search_element))
+            return Value(-1);
+        auto const& elements = storage->elements();
+        for (k = min(k, static_cast<ssize_t>(storage->array_like_size()) - 1); k >= 0; --k) {
+            auto element = elements[k];
+            if (!element.is_special_empty_value() && is_strictly_equal(search_element, element))
+                return Value((size_t)k);
+        }
+        return Value(-1);
+    }
+
     // 8. Repeat, while k ≥ 0,
     for (; k >= 0; --k) {
         auto property_key = PropertyKey { k };
@@ -1007,6 +1071,21 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::push)
     auto new_length = length + argument_count;
     if (new_length > MAX_ARRAY_LIKE_INDEX)
         return vm.throw_completion<TypeError>(ErrorType::ArrayMaxSize);
+
+    // OPTIMIZATION: If this object is an Array that:
+    // - is not a proxy target, which means set will not trap.
+    // - has intact prototype chain, which means there are no setters for the new indices.
+    // - has simple storage type, writable length and is extensible, which means every set would succeed.
+    // then we could take a fast path by directly appending the arguments to indexed storage.
+    if (auto* array = as_if<Array>(*this_object); array && !array->is_proxy_target() && array->default_prototype_chain_intact() && array->length_is_writable() && TRY(array->is_extensible())) {
+        auto* storage = array->indexed_properties().storage();
+        if (!storage || storage->is_simple_storage()) {
+            for (size_t i = 0; i < argument_count; ++i)
+                array->indexed_properties().append(vm.argument(i));
+            return Value(new_length);
+        }
+    }
+
     for (size_t i = 0; i < argument_count; ++i)
         TRY(this_object->set(length + i, vm.argument(i), Object::ShouldThrowExceptions::Yes));
     auto new_length_value = Value(new_length);
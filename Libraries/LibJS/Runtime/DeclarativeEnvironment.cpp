@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/Error.h>
@@ -15,6 +16,14 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(DeclarativeEnvironment);
 
+// NOTE: Serial numbers are unique across all environments, so that a cache filled for one environment can't be mistaken
+//       for a cache of another one, e.g. when an executable is shared between realms.
+static u64 next_environment_serial_number()
+{
+    static Atomic<u64> s_next_environment_serial_number { 1 };
+    return s_next_environment_serial_number.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+}
+
 DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_bindings(Badge<ForStatement>, DeclarativeEnvironment& other, size_t bindings_size)
 {
     auto bindings = other.m_bindings.span().slice(0, bindings_size);
@@ -26,12 +35,14 @@ DeclarativeEnvironment* DeclarativeEnvironment::create_for_per_iteration_binding
 DeclarativeEnvironment::DeclarativeEnvironment()
     : Environment(nullptr, IsDeclarative::Yes)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(next_environment_serial_number())
 {
 }
 
 DeclarativeEnvironment::DeclarativeEnvironment(Environment* parent_environment)
     : Environment(parent_environment, IsDeclarative::Yes)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(next_environment_serial_number())
 {
 }
 
@@ -39,6 +50,7 @@ DeclarativeEnvironment::DeclarativeEnvironment(Environment* parent_environment,
     : Environment(parent_environment, IsDeclarative::Yes)
     , m_bindings(bindings)
     , m_dispose_capability(new_dispose_capability())
+    , m_environment_serial_number(next_environment_serial_number())
 {
 }
 
@@ -79,7 +91,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_mutable_binding(VM&, Utf1
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -102,7 +114,7 @@ ThrowCompletionOr<void> DeclarativeEnvironment::create_immutable_binding(VM&, Ut
         .initialized = false,
     });
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 3. Return unused.
     return {};
@@ -212,7 +224,7 @@ ThrowCompletionOr<bool> DeclarativeEnvironment::delete_binding(VM&, Utf16FlyStri
     // NOTE: We keep the entries in m_bindings to avoid disturbing indices.
     binding_and_index->binding() = {};
 
-    ++m_environment_serial_number;
+    m_environment_serial_number = next_environment_serial_number();
 
     // 4. Return true.
     return true;
@@ -257,6 +257,8 @@ ThrowCompletionOr<void> ECMAScriptFunctionObject::get_stack_frame_size(size_t& r
     auto& executable = shared_data().m_executable;
     if (!executable) {
         if (is_module_wrapper()) {
+            // NB: Module wrappers aren't compiled from their shared data, but we still need to know whether they need a function environment.
+            const_cast<SharedFunctionInstanceData&>(shared_data()).ensure_function_declaration_instantiation_is_analyzed();
             executable = TRY(Bytecode::compile(vm(), ecmascript_code(), kind(), name()));
         } else {
             executable = TRY(Bytecode::compile(vm(), shared_data(), Bytecode::BuiltinAbstractOperationsEnabled::No));
@@ -93,6 +93,8 @@ public:
     GC::Ptr<DeclarativeEnvironment> global_declarative_environment;
     Utf16FlyString const* identifier_table { nullptr };
     PropertyKey const* property_key_table { nullptr };
+    Bytecode::GlobalVariableCache* global_variable_caches { nullptr };
+    Bytecode::TemplateObjectCache* template_object_caches { nullptr };
 
     u32 program_counter { 0 };
 
@@ -17,6 +17,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        update_element_kind(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +61,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    update_element_kind(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -100,10 +103,13 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
     if (old_size <= m_array_size) {
         m_number_of_empty_elements += m_array_size - old_size;
     } else {
+        // The removed elements may have been the only ones keeping the storage at a more generic element kind.
         m_number_of_empty_elements = 0;
+        m_element_kind = ElementKind::Int32;
         for (auto& value : m_packed_elements) {
             if (value.is_special_empty_value())
                 ++m_number_of_empty_elements;
+            update_element_kind(value);
         }
     }
 
@@ -60,6 +60,14 @@ private:
     bool m_is_simple_storage { false };
 };
 
+// The kind of values stored in a SimpleIndexedPropertyStorage, ignoring holes.
+// Kinds only ever transition towards more generic ones (Int32 -> Number -> Any), except when the storage is shrunk.
+enum class ElementKind : u8 {
+    Int32,
+    Number,
+    Any,
+};
+
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
     SimpleIndexedPropertyStorage()
@@ -95,12 +103,25 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+
+    // Numbers are never cells, so storage that only holds numbers has nothing for the GC to visit.
+    bool may_contain_cells() const { return m_element_kind == ElementKind::Any; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    ALWAYS_INLINE void update_element_kind(Value value)
+    {
+        if (m_element_kind == ElementKind::Any || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_element_kind = value.is_number() ? ElementKind::Number : ElementKind::Any;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
+    ElementKind m_element_kind { ElementKind::Int32 };
     Vector<Value> m_packed_elements;
 };
 
@@ -4,11 +4,13 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/CharacterTypes.h>
 #include <AK/Function.h>
 #include <AK/JsonArray.h>
 #include <AK/JsonObject.h>
 #include <AK/JsonParser.h>
 #include <AK/StringBuilder.h>
+#include <AK/StringConversions.h>
 #include <AK/TypeCasts.h>
 #include <AK/Utf16View.h>
 #include <AK/Utf8View.h>
@@ -447,21 +449,301 @@ JS_DEFINE_NATIVE_FUNCTION(JSONObject::parse)
     return unfiltered;
 }
 
+// Parses ECMA-404 JSON text and creates the corresponding JS values in the same pass, so that we don't have to
+// build (and then walk) an intermediate AK::JsonValue tree first.
+class JSONTextParser {
+public:
+    JSONTextParser(VM& vm, StringView text)
+        : m_vm(vm)
+        , m_realm(*vm.current_realm())
+        , m_text(text)
+    {
+    }
+
+    ThrowCompletionOr<Value> parse()
+    {
+        auto value = TRY(parse_value());
+        skip_whitespace();
+        if (!is_eof())
+            return syntax_error();
+        return value;
+    }
+
+private:
+    bool is_eof() const { return m_index >= m_text.length(); }
+    char peek() const { return is_eof() ? '\0' : m_text[m_index]; }
+
+    Completion syntax_error() const
+    {
+        return m_vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
+    }
+
+    void skip_whitespace()
+    {
+        while (!is_eof()) {
+            auto ch = m_text[m_index];
+            if (ch != ' ' && ch != '\n' && ch != '\r' && ch != '\t')
+                return;
+            ++m_index;
+        }
+    }
+
+    bool consume_specific(char ch)
+    {
+        if (peek() != ch)
+            return false;
+        ++m_index;
+        return true;
+    }
+
+    ThrowCompletionOr<Value> parse_value()
+    {
+        skip_whitespace();
+        switch (peek()) {
+        case '{':
+            return parse_object();
+        case '[':
+            return parse_array();
+        case '"': {
+            auto string = TRY(consume_string());
+            return string.visit(
+                [&](StringView string) { return PrimitiveString::create(m_vm, String::from_utf8_without_validation(string.bytes())); },
+                [&](Utf16String const& string) { return PrimitiveString::create(m_vm, string); });
+        }
+        case 't':
+            return parse_literal("true"sv, Value(true));
+        case 'f':
+            return parse_literal("false"sv, Value(false));
+        case 'n':
+            return parse_literal("null"sv, js_null());
+        default:
+            return parse_number();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_literal(StringView literal, Value value)
+    {
+        if (!m_text.substring_view(m_index).starts_with(literal))
+            return syntax_error();
+        m_index += literal.length();
+        return value;
+    }
+
+    ThrowCompletionOr<Value> parse_object()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        VERIFY(consume_specific('{'));
+
+        // NOTE: Objects with the same keys in the same order end up sharing a shape through the shape transition cache.
+        auto object = Object::create(m_realm, m_realm.intrinsics().object_prototype());
+
+        skip_whitespace();
+        if (consume_specific('}'))
+            return object;
+
+        for (;;) {
+            skip_whitespace();
+            if (peek() != '"')
+                return syntax_error();
+            auto key = TRY(consume_property_key());
+
+            skip_whitespace();
+            if (!consume_specific(':'))
+                return syntax_error();
+
+            auto value = TRY(parse_value());
+            object->define_direct_property(key, value, default_attributes);
+
+            skip_whitespace();
+            if (consume_specific('}'))
+                return object;
+            if (!consume_specific(','))
+                return syntax_error();
+        }
+    }
+
+    ThrowCompletionOr<Value> parse_array()
+    {
+        if (m_vm.did_reach_stack_space_limit())
+            return m_vm.throw_completion<InternalError>(ErrorType::CallStackSizeExceeded);
+
+        VERIFY(consume_specific('['));
+
+        GC::RootVector<Value> elements { m_vm.heap() };
+
+        skip_whitespace();
+        if (!consume_specific(']')) {
+            for (;;) {
+                elements.append(TRY(parse_value()));
+
+                skip_whitespace();
+                if (consume_specific(']'))
+                    break;
+                if (!consume_specific(','))
+                    return syntax_error();
+            }
+        }
+
+        auto array = MUST(Array::create(m_realm, 0));
+        array->set_indexed_property_elements(move(static_cast<Vector<Value>&>(elements)));
+        return array;
+    }
+
+    ThrowCompletionOr<Value> parse_number()
+    {
+        auto start = m_index;
+        auto consume_digits = [&] {
+            auto digits_start = m_index;
+            while (is_ascii_digit(peek()))
+                ++m_index;
+            return m_index - digits_start;
+        };
+
+        bool negative = consume_specific('-');
+
+        // Leading zeros are not allowed.
+        auto integer_digits_start = m_index;
+        auto integer_digit_count = consume_digits();
+        if (integer_digit_count == 0 || (integer_digit_count > 1 && m_text[integer_digits_start] == '0'))
+            return syntax_error();
+
+        bool is_integer = true;
+        if (consume_specific('.')) {
+            is_integer = false;
+            if (consume_digits() == 0)
+                return syntax_error();
+        }
+        if (consume_specific('e') || consume_specific('E')) {
+            is_integer = false;
+            if (!consume_specific('+'))
+                (void)consume_specific('-');
+            if (consume_digits() == 0)
+                return syntax_error();
+        }
+
+        // OPTIMIZATION: Integers with up to 15 digits can be represented exactly, so we can accumulate them directly.
+        if (is_integer && integer_digit_count <= 15) {
+            i64 value = 0;
+            for (auto ch : m_text.substring_view(integer_digits_start, integer_digit_count))
+                value = value * 10 + parse_ascii_digit(ch);
+            return Value(negative ? -static_cast<double>(value) : static_cast<double>(value));
+        }
+
+        auto result = AK::parse_number<double>(m_text.substring_view(start, m_index - start), TrimWhitespace::No);
+        if (!result.has_value())
+            return syntax_error();
+        return Value(*result);
+    }
+
+    // Returns the contents of the string as-is if they contain no escape sequences, which is by far the most common case.
+    ThrowCompletionOr<Variant<StringView, Utf16String>> consume_string()
+    {
+        VERIFY(consume_specific('"'));
+
+        auto is_plain_character = [&](char ch) {
+            return ch != '"' && ch != '\\' && !is_ascii_c0_control(ch);
+        };
+
+        // NOTE: Every byte of a multi-byte UTF-8 sequence has its high bit set, so scanning byte by byte is fine here.
+        auto start = m_index;
+        while (!is_eof() && is_plain_character(m_text[m_index]))
+            ++m_index;
+
+        if (consume_specific('"'))
+            return m_text.substring_view(start, m_index - start - 1);
+
+        StringBuilder builder(StringBuilder::Mode::UTF16);
+        builder.append(m_text.substring_view(start, m_index - start));
+
+        for (;;) {
+            if (consume_specific('"'))
+                return builder.to_utf16_string();
+            if (!consume_specific('\\'))
+                return syntax_error();
+
+            switch (peek()) {
+            case '"':
+            case '\\':
+            case '/':
+                builder.append_code_unit(m_text[m_index++]);
+                break;
+            case 'b':
+                ++m_index;
+                builder.append_code_unit('\b');
+                break;
+            case 'f':
+                ++m_index;
+                builder.append_code_unit('\f');
+                break;
+            case 'n':
+                ++m_index;
+                builder.append_code_unit('\n');
+                break;
+            case 'r':
+                ++m_index;
+                builder.append_code_unit('\r');
+                break;
+            case 't':
+                ++m_index;
+                builder.append_code_unit('\t');
+                break;
+            case 'u': {
+                ++m_index;
+                // NOTE: Surrogate pairs are made of two escapes, and JSON allows lone surrogates. Both work out
+                //       naturally by appending each escape as a single UTF-16 code unit.
+                char16_t code_unit = 0;
+                for (size_t i = 0; i < 4; ++i) {
+                    if (!is_ascii_hex_digit(peek()))
+                        return syntax_error();
+                    code_unit = (code_unit << 4) | parse_ascii_hex_digit(m_text[m_index++]);
+                }
+                builder.append_code_unit(code_unit);
+                break;
+            }
+            default:
+                return syntax_error();
+            }
+
+            auto run_start = m_index;
+            while (!is_eof() && is_plain_character(m_text[m_index]))
+                ++m_index;
+            builder.append(m_text.substring_view(run_start, m_index - run_start));
+        }
+    }
+
+    ThrowCompletionOr<PropertyKey> consume_property_key()
+    {
+        auto string = TRY(consume_string());
+        if (auto* utf16_string = string.get_pointer<Utf16String>())
+            return PropertyKey { *utf16_string };
+
+        // OPTIMIZATION: Large JSON texts tend to repeat the same keys over and over, so let's only convert each of them once.
+        auto key = string.get<StringView>();
+        return m_property_key_cache.ensure(key, [&] {
+            return PropertyKey { Utf16FlyString::from_utf8_without_validation(key) };
+        });
+    }
+
+    VM& m_vm;
+    Realm& m_realm;
+    StringView m_text;
+    size_t m_index { 0 };
+    HashMap<StringView, PropertyKey> m_property_key_cache;
+};
+
 // 25.5.1.1 ParseJSON ( text ), https://tc39.es/ecma262/#sec-ParseJSON
 ThrowCompletionOr<Value> JSONObject::parse_json(VM& vm, StringView text)
 {
-    auto json = JsonValue::from_string(text);
-
     // 1. If StringToCodePoints(text) is not a valid JSON text as specified in ECMA-404, throw a SyntaxError exception.
-    if (json.is_error())
-        return vm.throw_completion<SyntaxError>(ErrorType::JsonMalformed);
-
     // 2. Let scriptString be the string-concatenation of "(", text, and ");".
     // 3. Let script be ParseText(scriptString, Script).
     // 4. NOTE: The early error rules defined in 13.2.5.1 have special handling for the above invocation of ParseText.
     // 5. Assert: script is a Parse Node.
     // 6. Let result be ! Evaluation of script.
-    auto result = JSONObject::parse_json_value(vm, json.value());
+    // NOTE: We validate the text and evaluate it in a single pass.
+    auto result = TRY(JSONTextParser(vm, text).parse());
 
     // 7. NOTE: The PropertyDefinitionEvaluation semantics defined in 13.2.5.5 have special handling for the above evaluation.
     // 8. Assert: result is either a String, a Number, a Boolean, an Object that is defined by either an ArrayLiteral or an ObjectLiteral, or null.
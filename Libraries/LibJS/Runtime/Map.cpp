@@ -10,6 +10,9 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(Map);
 
+static constexpr u32 END_OF_BUCKET = NumericLimits<u32>::max();
+static constexpr size_t MINIMUM_BUCKET_COUNT = 8;
+
 GC::Ref<Map> Map::create(Realm& realm)
 {
     return realm.create<Map>(realm.intrinsics().map_prototype());
@@ -20,74 +23,154 @@ Map::Map(Object& prototype)
 {
 }
 
+GC::Ref<Map> Map::copy() const
+{
+    auto result = Map::create(*vm().current_realm());
+    result->m_entries = m_entries;
+    result->m_buckets = m_buckets;
+    result->m_removed_entry_count = m_removed_entry_count;
+    result->m_next_insertion_id = m_next_insertion_id;
+    return result;
+}
+
 // 24.1.3.1 Map.prototype.clear ( ), https://tc39.es/ecma262/#sec-map.prototype.clear
 void Map::map_clear()
 {
-    m_keys.clear();
+    // NOTE: We keep handing out new insertion IDs, so that live iterators will pick up entries added after this.
     m_entries.clear();
+    m_buckets.clear();
+    m_removed_entry_count = 0;
 }
 
 // 24.1.3.3 Map.prototype.delete ( key ), https://tc39.es/ecma262/#sec-map.prototype.delete
 bool Map::map_remove(Value const& key)
 {
-    Optional<size_t> index;
-
-    for (auto it = m_keys.begin(); !it.is_end(); ++it) {
-        if (ValueTraits::equals(*it, key)) {
-            index = it.key();
-            break;
-        }
-    }
-
-    if (!index.has_value())
+    if (m_buckets.is_empty())
         return false;
 
-    m_keys.remove(*index);
-    m_entries.remove(key);
-    return true;
+    auto hash = ValueTraits::hash(key);
+    for (auto* link = &m_buckets[hash & (m_buckets.size() - 1)]; *link != END_OF_BUCKET; link = &m_entries[*link].next_in_bucket) {
+        auto& entry = m_entries[*link];
+        if (entry.hash != hash || !ValueTraits::equals(entry.key, key))
+            continue;
+
+        *link = entry.next_in_bucket;
+        entry.key = js_special_empty_value();
+        entry.value = js_undefined();
+        ++m_removed_entry_count;
+
+        // Once most of the entries are holes, get rid of them so iteration doesn't have to skip over them.
+        if (m_removed_entry_count >= MINIMUM_BUCKET_COUNT && m_removed_entry_count > map_size())
+            rehash(map_size());
+        return true;
+    }
+    return false;
 }
 
 // 24.1.3.6 Map.prototype.get ( key ), https://tc39.es/ecma262/#sec-map.prototype.get
 Optional<Value> Map::map_get(Value const& key) const
 {
-    if (auto it = m_entries.find(key); it != m_entries.end())
-        return it->value;
+    if (auto position = find_position(key, ValueTraits::hash(key)); position.has_value())
+        return m_entries[*position].value;
     return {};
 }
 
 // 24.1.3.7 Map.prototype.has ( key ), https://tc39.es/ecma262/#sec-map.prototype.has
 bool Map::map_has(Value const& key) const
 {
-    return m_entries.contains(key);
+    return find_position(key, ValueTraits::hash(key)).has_value();
 }
 
 // 24.1.3.9 Map.prototype.set ( key, value ), https://tc39.es/ecma262/#sec-map.prototype.set
 void Map::map_set(Value const& key, Value value)
 {
-    auto it = m_entries.find(key);
-    if (it != m_entries.end()) {
-        it->value = value;
-    } else {
-        auto index = m_next_insertion_id++;
-        m_keys.insert(index, key);
-        m_entries.set(key, value);
+    auto hash = ValueTraits::hash(key);
+    if (auto position = find_position(key, hash); position.has_value()) {
+        m_entries[*position].value = value;
+        return;
     }
+
+    if (m_entries.size() >= m_buckets.size())
+        rehash(map_size() + 1);
+
+    VERIFY(m_entries.size() < END_OF_BUCKET);
+    auto& bucket = m_buckets[hash & (m_buckets.size() - 1)];
+    m_entries.append({
+        .key = key,
+        .value = value,
+        .insertion_id = m_next_insertion_id++,
+        .hash = hash,
+        .next_in_bucket = bucket,
+    });
+    bucket = static_cast<u32>(m_entries.size() - 1);
 }
 
 size_t Map::map_size() const
 {
-    return m_keys.size();
+    return m_entries.size() - m_removed_entry_count;
+}
+
+Optional<size_t> Map::find_position(Value const& key, u32 hash) const
+{
+    if (m_buckets.is_empty())
+        return {};
+
+    for (auto position = m_buckets[hash & (m_buckets.size() - 1)]; position != END_OF_BUCKET; position = m_entries[position].next_in_bucket) {
+        auto const& entry = m_entries[position];
+        if (entry.hash == hash && ValueTraits::equals(entry.key, key))
+            return position;
+    }
+    return {};
+}
+
+size_t Map::position_of_first_entry_not_inserted_before(size_t insertion_id) const
+{
+    // NOTE: Entries are always appended with a new, larger insertion ID, and compaction keeps their order.
+    size_t low = 0;
+    size_t high = m_entries.size();
+    while (low < high) {
+        auto middle = low + (high - low) / 2;
+        if (m_entries[middle].insertion_id < insertion_id)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    return low;
+}
+
+void Map::rehash(size_t minimum_entry_capacity)
+{
+    if (m_removed_entry_count > 0) {
+        size_t live_entry_count = 0;
+        for (auto& entry : m_entries) {
+            if (!entry.key.is_special_empty_value())
+                m_entries[live_entry_count++] = entry;
+        }
+        m_entries.shrink(live_entry_count);
+        m_removed_entry_count = 0;
+    }
+
+    // Keep the load factor at or below 1/2 right after rehashing, so that we don't immediately have to do it again.
+    size_t bucket_count = MINIMUM_BUCKET_COUNT;
+    while (bucket_count < minimum_entry_capacity * 2)
+        bucket_count *= 2;
+
+    m_buckets.clear_with_capacity();
+    m_buckets.resize_with_default_value(bucket_count, END_OF_BUCKET);
+    for (size_t position = 0; position < m_entries.size(); ++position) {
+        auto& bucket = m_buckets[m_entries[position].hash & (bucket_count - 1)];
+        m_entries[position].next_in_bucket = bucket;
+        bucket = static_cast<u32>(position);
+    }
 }
 
 void Map::visit_edges(Cell::Visitor& visitor)
 {
     Base::visit_edges(visitor);
-    for (auto& value : m_entries) {
-        visitor.visit(value.key);
-        visitor.visit(value.value);
+    for (auto& entry : m_entries) {
+        visitor.visit(entry.key);
+        visitor.visit(entry.value);
     }
-    // NOTE: The entries in m_keys are already visited by the walk over m_entries above.
-    visitor.ignore(m_keys);
 }
 
 }
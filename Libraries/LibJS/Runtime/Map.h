@@ -6,8 +6,7 @@
 
 #pragma once
 
-#include <AK/HashMap.h>
-#include <AK/RedBlackTree.h>
+#include <AK/Vector.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Object.h>
@@ -34,6 +33,18 @@ public:
     void map_set(Value const&, Value);
     size_t map_size() const;
 
+    GC::Ref<Map> copy() const;
+
+    struct Entry {
+        Value key;
+        Value value;
+
+        // NOTE: Insertion IDs only ever grow, which lets iterators find their place again after the entries have moved.
+        size_t insertion_id { 0 };
+        u32 hash { 0 };
+        u32 next_in_bucket { 0 };
+    };
+
     struct EndIterator {
     };
 
@@ -41,29 +52,31 @@ public:
     struct IteratorImpl {
         bool is_end() const
         {
-            return m_map->m_keys.begin_from(m_index).is_end()
-                && m_map->m_keys.find_smallest_not_below_iterator(m_index).is_end();
+            ensure_next_element();
+            return m_position >= m_map->m_entries.size();
         }
 
         IteratorImpl& operator++()
         {
-            ++m_index;
+            ensure_next_element();
+            if (m_position < m_map->m_entries.size())
+                m_insertion_id = m_map->m_entries[m_position++].insertion_id + 1;
             return *this;
         }
 
         decltype(auto) operator*()
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return m_map->m_entries[m_position];
         }
 
         decltype(auto) operator*() const
         {
             ensure_next_element();
-            return *m_map->m_entries.find(*m_map->m_keys.begin_from(m_index));
+            return m_map->m_entries[m_position];
         }
 
-        bool operator==(IteratorImpl const& other) const { return m_index == other.m_index && &m_map == &other.m_map; }
+        bool operator==(IteratorImpl const& other) const { return m_insertion_id == other.m_insertion_id && m_map.ptr() == other.m_map.ptr(); }
         bool operator==(EndIterator const&) const { return is_end(); }
 
     private:
@@ -72,34 +85,28 @@ public:
         requires(IsConst)
             : m_map(map)
         {
-            ensure_index();
         }
 
         IteratorImpl(Map& map)
         requires(!IsConst)
             : m_map(map)
         {
-            ensure_index();
-        }
-
-        void ensure_index() const
-        {
-            if (m_map->m_keys.is_empty())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = m_map->m_keys.begin().key();
         }
 
+        // Moves to the first live entry that was inserted no earlier than the one we're looking for.
         void ensure_next_element() const
         {
-            if (auto it = m_map->m_keys.find_smallest_not_below_iterator(m_index); it.is_end())
-                m_index = m_map->m_next_insertion_id;
-            else
-                m_index = it.key();
+            auto const& entries = m_map->m_entries;
+            if (m_position >= entries.size() || entries[m_position].insertion_id != m_insertion_id)
+                m_position = m_map->position_of_first_entry_not_inserted_before(m_insertion_id);
+            while (m_position < entries.size() && entries[m_position].key.is_special_empty_value())
+                ++m_position;
+            m_insertion_id = m_position < entries.size() ? entries[m_position].insertion_id : m_map->m_next_insertion_id;
         }
 
         Conditional<IsConst, GC::Ref<Map const>, GC::Ref<Map>> m_map;
-        mutable size_t m_index { 0 };
+        mutable size_t m_insertion_id { 0 };
+        mutable size_t m_position { 0 };
     };
 
     using Iterator = IteratorImpl<false>;
@@ -113,9 +120,17 @@ private:
     explicit Map(Object& prototype);
     virtual void visit_edges(Visitor& visitor) override;
 
+    Optional<size_t> find_position(Value const& key, u32 hash) const;
+    size_t position_of_first_entry_not_inserted_before(size_t insertion_id) const;
+    void rehash(size_t minimum_entry_capacity);
+
+    // NOTE: The entries are kept in insertion order, with removed entries left behind as holes (an empty key) until
+    //       the next rehash. Each bucket holds the position of the first entry in its chain, and the chain continues
+    //       through Entry::next_in_bucket. This keeps lookups, insertions and iteration on a single dense array.
+    Vector<Entry> m_entries;
+    Vector<u32> m_buckets;
+    size_t m_removed_entry_count { 0 };
     size_t m_next_insertion_id { 0 };
-    RedBlackTree<size_t, Value> m_keys;
-    HashMap<Value, Value, ValueTraits> m_entries;
 };
 
 template<>
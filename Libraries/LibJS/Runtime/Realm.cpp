@@ -7,6 +7,7 @@
 
 #include <AK/TypeCasts.h>
 #include <LibGC/DeferGC.h>
+#include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/NativeFunction.h>
@@ -17,6 +18,8 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(Realm);
 
+Realm::~Realm() = default;
+
 // 9.3.1 InitializeHostDefinedRealm ( ), https://tc39.es/ecma262/#sec-initializehostdefinedrealm
 ThrowCompletionOr<NonnullOwnPtr<ExecutionContext>> Realm::initialize_host_defined_realm(VM& vm, Function<Object*(Realm&)> create_global_object, Function<Object*(Realm&)> create_global_this_value)
 {
@@ -99,8 +102,21 @@ void Realm::visit_edges(Visitor& visitor)
     visitor.visit(m_intrinsics);
     visitor.visit(m_global_object);
     visitor.visit(m_global_environment);
+    visitor.visit(m_template_map);
     if (m_host_defined)
         m_host_defined->visit_edges(visitor);
+    for (auto const& it : m_caches_for_shared_executables)
+        visitor.visit(it.key);
+}
+
+Bytecode::RealmSpecificCaches& Realm::caches_for_shared_executable(Bytecode::Executable& executable)
+{
+    return *m_caches_for_shared_executables.ensure(executable, [&] {
+        auto caches = make<Bytecode::RealmSpecificCaches>();
+        caches->global_variable_caches.resize(executable.global_variable_caches.size());
+        caches->template_object_caches.resize(executable.template_object_caches.size());
+        return caches;
+    });
 }
 
 }
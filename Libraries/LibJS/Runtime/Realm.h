@@ -8,8 +8,11 @@
 #pragma once
 
 #include <AK/Badge.h>
+#include <AK/HashMap.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/OwnPtr.h>
 #include <AK/StringView.h>
+#include <AK/Vector.h>
 #include <AK/Weakable.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -68,6 +71,14 @@ public:
 
     void set_host_defined(OwnPtr<HostDefined> host_defined) { m_host_defined = move(host_defined); }
 
+    // NOTE: Template objects are looked up through the TemplateObjectCache of their site, so all we need to do here is keep them alive.
+    void add_to_template_map(GC::Ref<Array> template_object) { m_template_map.append(template_object); }
+
+    // Returns this realm's copy of the caches of an executable whose own caches belong to another realm.
+    Bytecode::RealmSpecificCaches& caches_for_shared_executable(Bytecode::Executable&);
+
+    virtual ~Realm() override;
+
 private:
     Realm() = default;
 
@@ -76,7 +87,10 @@ private:
     GC::Ptr<Intrinsics> m_intrinsics;                // [[Intrinsics]]
     GC::Ptr<Object> m_global_object;                 // [[GlobalObject]]
     GC::Ptr<GlobalEnvironment> m_global_environment; // [[GlobalEnv]]
+    Vector<GC::Ref<Array>> m_template_map;           // [[TemplateMap]]
     OwnPtr<HostDefined> m_host_defined;              // [[HostDefined]]
+
+    HashMap<GC::Ref<Bytecode::Executable>, NonnullOwnPtr<Bytecode::RealmSpecificCaches>> m_caches_for_shared_executables;
 };
 
 }
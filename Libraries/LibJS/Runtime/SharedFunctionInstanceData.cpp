@@ -35,6 +35,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     , m_contains_direct_call_to_eval(parsing_insights.contains_direct_call_to_eval)
     , m_is_arrow_function(is_arrow_function)
     , m_uses_this(parsing_insights.uses_this)
+    , m_uses_this_from_environment(parsing_insights.uses_this_from_environment)
 {
     if (m_is_arrow_function)
         m_this_mode = ThisMode::Lexical;
@@ -53,6 +54,17 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
             return false;
         return true;
     });
+}
+
+void SharedFunctionInstanceData::ensure_function_declaration_instantiation_is_analyzed()
+{
+    // NOTE: Most functions on a typical web page are never called, so we defer this work until the function
+    //       is about to be compiled for the first time instead of paying for it when the function object is created.
+    if (m_function_declaration_instantiation_is_analyzed)
+        return;
+    m_function_declaration_instantiation_is_analyzed = true;
+
+    auto& vm = this->vm();
 
     // NOTE: The following steps are from FunctionDeclarationInstantiation that could be executed once
     //       and then reused in all subsequent function instantiations.
@@ -146,7 +158,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
 
     size_t parameter_environment_bindings_count = 0;
     // 19. If strict is true or hasParameterExpressions is false, then
-    if (strict || !m_has_parameter_expressions) {
+    if (m_strict || !m_has_parameter_expressions) {
         // a. NOTE: Only a single Environment Record is needed for the parameters, since calls to eval in strict mode code cannot create new bindings which are visible outside of the eval.
         // b. Let env be the LexicalEnvironment of calleeContext
         // NOTE: Here we are only interested in the size of the environment.
@@ -285,7 +297,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
         }));
     }
 
-    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || parsing_insights.uses_this_from_environment || m_contains_direct_call_to_eval;
+    m_function_environment_needed = arguments_object_needs_binding || m_function_environment_bindings_count > 0 || m_var_environment_bindings_count > 0 || m_lex_environment_bindings_count > 0 || m_uses_this_from_environment || m_contains_direct_call_to_eval;
 }
 
 void SharedFunctionInstanceData::visit_edges(Visitor& visitor)
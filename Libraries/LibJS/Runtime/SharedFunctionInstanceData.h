@@ -44,6 +44,11 @@ public:
         FunctionParsingInsights const&,
         Vector<LocalVariable> local_variables_names);
 
+    // Performs the parts of FunctionDeclarationInstantiation that only depend on the function's code.
+    // The fields from m_has_parameter_expressions to m_lex_environment_bindings_count are only valid after this has been called,
+    // which happens right before the function is compiled for the first time.
+    void ensure_function_declaration_instantiation_is_analyzed();
+
     mutable GC::Ptr<Bytecode::Executable> m_executable;
 
     RefPtr<FunctionParameters const> m_formal_parameters; // [[FormalParameters]]
@@ -87,6 +92,8 @@ public:
     bool m_arguments_object_needed { false };
     bool m_function_environment_needed { false };
     bool m_uses_this { false };
+    bool m_uses_this_from_environment { false };
+    bool m_function_declaration_instantiation_is_analyzed { false };
     Vector<VariableNameToInitialize> m_var_names_to_initialize_binding;
     Vector<Utf16FlyString> m_function_names_to_initialize_binding;
 
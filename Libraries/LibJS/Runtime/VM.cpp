@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -72,13 +73,14 @@ static constexpr auto make_single_ascii_character_strings(IndexSequence<code_poi
 
 static constexpr auto single_ascii_character_strings = make_single_ascii_character_strings(MakeIndexSequence<128>());
 VM::VM(ErrorMessages error_messages)
-    : m_heap([this](HashMap<GC::Cell*, GC::HeapRoot>& roots) {
+    : m_heap([this](GC::RootCollector& roots) {
         gather_roots(roots);
     })
     , m_error_messages(move(error_messages))
 {
     s_the = this;
     m_bytecode_interpreter = make<Bytecode::Interpreter>();
+    m_program_cache = make<ProgramCache>();
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
@@ -255,9 +257,14 @@ Utf16String const& VM::error_message(ErrorMessage type) const
 }
 
 struct ExecutionContextRootsCollector : public Cell::Visitor {
+    explicit ExecutionContextRootsCollector(GC::RootCollector& roots)
+        : roots(roots)
+    {
+    }
+
     virtual void visit_impl(GC::Cell& cell) override
     {
-        roots.set(&cell);
+        roots.add_root(&cell, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
     }
 
     virtual void visit_possible_values(ReadonlyBytes) override
@@ -265,57 +272,54 @@ struct ExecutionContextRootsCollector : public Cell::Visitor {
         VERIFY_NOT_REACHED();
     }
 
-    HashTable<GC::Ptr<GC::Cell>> roots;
+    GC::RootCollector& roots;
 };
 
-void VM::gather_roots(HashMap<GC::Cell*, GC::HeapRoot>& roots)
+void VM::gather_roots(GC::RootCollector& roots)
 {
-    roots.set(m_empty_string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(m_empty_string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
     for (auto string : m_single_ascii_character_strings)
-        roots.set(string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.add_root(string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
     for (auto string : m_numeric_string_cache) {
         // The numeric string cache is populated lazily, so skip null entries.
         if (!string)
             continue;
-        roots.set(string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.add_root(string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
     }
 
-    roots.set(cached_strings.number, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.undefined, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.object, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.symbol, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.boolean, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.bigint, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.function, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-    roots.set(cached_strings.object_Object, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.number, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.undefined, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.object, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.string, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.symbol, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.boolean, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.bigint, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.function, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(cached_strings.object_Object, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
 #define __JS_ENUMERATE(SymbolName, snake_name) \
-    roots.set(m_well_known_symbols.snake_name, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+    roots.add_root(m_well_known_symbols.snake_name, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
     JS_ENUMERATE_WELL_KNOWN_SYMBOLS
 #undef __JS_ENUMERATE
 
     for (auto& symbol : m_global_symbol_registry)
-        roots.set(symbol.value, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.add_root(symbol.value, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
     for (auto finalization_registry : m_finalization_registry_cleanup_jobs)
-        roots.set(finalization_registry, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.add_root(finalization_registry, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 
     auto gather_roots_from_execution_context_stack = [&roots](Vector<ExecutionContext*> const& stack) {
-        for (auto const& execution_context : stack) {
-            ExecutionContextRootsCollector visitor;
+        ExecutionContextRootsCollector visitor { roots };
+        for (auto const& execution_context : stack)
             execution_context->visit_edges(visitor);
-            for (auto cell : visitor.roots)
-                roots.set(cell, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
-        }
     };
     gather_roots_from_execution_context_stack(m_execution_context_stack);
     for (auto& saved_stack : m_saved_execution_context_stacks)
         gather_roots_from_execution_context_stack(saved_stack);
 
     for (auto& job : m_promise_jobs)
-        roots.set(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
+        roots.add_root(job, GC::HeapRoot { .type = GC::HeapRoot::Type::VM });
 }
 
 // 9.1.2.1 GetIdentifierReference ( env, name, strict ), https://tc39.es/ecma262/#sec-getidentifierreference
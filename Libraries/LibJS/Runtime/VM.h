@@ -64,9 +64,11 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
 
+    ProgramCache& program_cache() { return *m_program_cache; }
+
     void dump_backtrace() const;
 
-    void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
+    void gather_roots(GC::RootCollector&);
 
 #define __JS_ENUMERATE(SymbolName, snake_name)             \
     GC::Ref<Symbol> well_known_symbol_##snake_name() const \
@@ -365,6 +367,8 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    OwnPtr<ProgramCache> m_program_cache;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -7,6 +7,7 @@
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
 
@@ -17,16 +18,25 @@ GC_DEFINE_ALLOCATOR(Script);
 // 16.1.5 ParseScript ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parse-script
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
-    // 1. Let script be ParseText(sourceText, Script).
-    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text)), line_number_offset));
-    auto script = parser.parse_program();
+    auto& program_cache = realm.vm().program_cache();
 
-    // 2. If script is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    // OPTIMIZATION: Reuse the parse tree if we've parsed the exact same script before.
+    auto script = program_cache.find(Program::Type::Script, source_text, filename, line_number_offset);
+    if (!script) {
+        // 1. Let script be ParseText(sourceText, Script).
+        auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text)), line_number_offset));
+        auto parsed_script = parser.parse_program();
+
+        // 2. If script is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        program_cache.add(Program::Type::Script, source_text, filename, line_number_offset, parsed_script, parser.parse_tree_node_bytes());
+        script = move(parsed_script);
+    }
 
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
-    return realm.heap().allocate<Script>(realm, filename, move(script), host_defined);
+    return realm.heap().allocate<Script>(realm, filename, script.release_nonnull(), host_defined);
 }
 
 Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program> parse_node, HostDefined* host_defined)
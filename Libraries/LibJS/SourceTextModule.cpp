@@ -9,6 +9,7 @@
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
@@ -131,13 +132,23 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 // 16.2.1.7.1 ParseModule ( sourceText, realm, hostDefined ), https://tc39.es/ecma262/#sec-parsemodule
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
-    // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text))), Program::Type::Module);
-    auto body = parser.parse_program();
+    auto& program_cache = realm.vm().program_cache();
 
-    // 2. If body is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    // OPTIMIZATION: Reuse the parse tree if we've parsed the exact same module before.
+    auto cached_body = program_cache.find(Program::Type::Module, source_text, filename, 1);
+    if (!cached_body) {
+        // 1. Let body be ParseText(sourceText, Module).
+        auto parser = Parser(Lexer(SourceCode::create(String::from_utf8(filename).release_value_but_fixme_should_propagate_errors(), Utf16String::from_utf8(source_text))), Program::Type::Module);
+        auto parsed_body = parser.parse_program();
+
+        // 2. If body is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        program_cache.add(Program::Type::Module, source_text, filename, 1, parsed_body, parser.parse_tree_node_bytes());
+        cached_body = move(parsed_body);
+    }
+    auto body = cached_body.release_nonnull();
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
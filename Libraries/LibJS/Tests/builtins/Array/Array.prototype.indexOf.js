@@ -23,3 +23,45 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("arrays holding only numbers", () => {
+    var array = [1, 2, 3, 2];
+
+    expect(array.indexOf(2)).toBe(1);
+    expect(array.lastIndexOf(2)).toBe(3);
+    expect(array.indexOf("2")).toBe(-1);
+    expect(array.includes("2")).toBeFalse();
+
+    array.push(4.5);
+    expect(array.indexOf(4.5)).toBe(4);
+
+    array.push("hello");
+    expect(array.indexOf("hello")).toBe(5);
+
+    array.length = 2;
+    expect(array.indexOf("hello")).toBe(-1);
+    expect(array.indexOf(2)).toBe(1);
+});
+
+test("holes", () => {
+    var array = [1, , 3];
+
+    expect(array.indexOf(undefined)).toBe(-1);
+    expect(array.lastIndexOf(undefined)).toBe(-1);
+    expect(array.includes(undefined)).toBeTrue();
+    expect([1, 2, 3].includes(undefined)).toBeFalse();
+});
+
+test("array shrinks while converting fromIndex", () => {
+    var array = [1, 2, 3, 4];
+    var fromIndex = {
+        valueOf() {
+            array.length = 1;
+            return 0;
+        },
+    };
+
+    expect(array.indexOf(3, fromIndex)).toBe(-1);
+    array = [1, 2, 3, 4];
+    expect(array.includes(undefined, fromIndex)).toBeTrue();
+});
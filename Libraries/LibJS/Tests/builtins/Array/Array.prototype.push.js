@@ -21,3 +21,9 @@ describe("normal behavior", () => {
         expect(a).toEqual(["hello", "friends", 1, 2, 3]);
     });
 });
+
+test("frozen array", () => {
+    var a = Object.freeze([1, 2]);
+    expect(() => a.push(3)).toThrow(TypeError);
+    expect(a).toEqual([1, 2]);
+});
@@ -74,3 +74,54 @@ test("does not truncate large integers", () => {
     expect(JSON.parse("18446744073709551616")).toEqual(18446744073709551616);
     expect(JSON.parse("18446744073709551617")).toEqual(18446744073709551617);
 });
+
+test("string escapes", () => {
+    expect(JSON.parse('"a\\"b\\\\c\\/d\\b\\f\\n\\r\\t"')).toBe('a"b\\c/d\b\f\n\r\t');
+    expect(JSON.parse('"\\u0041\\u00e9\\u20AC"')).toBe("Aé€");
+    expect(JSON.parse('"\\uD834\\uDD1E"')).toBe("𝄞");
+    expect(JSON.parse('"héllo wörld"')).toBe("héllo wörld");
+    expect(JSON.parse('"abc\\ndéf"')).toBe("abc\ndéf");
+});
+
+test("lone surrogates", () => {
+    const string = JSON.parse('"a\\uD800b"');
+    expect(string).toHaveLength(3);
+    expect(string.charCodeAt(1)).toBe(0xd800);
+    expect(JSON.parse('"\\uDC00"').charCodeAt(0)).toBe(0xdc00);
+});
+
+test("negative zero", () => {
+    expect(Object.is(JSON.parse("-0"), -0)).toBeTrue();
+    expect(Object.is(JSON.parse("0"), 0)).toBeTrue();
+    expect(JSON.parse("-0.5e1")).toBe(-5);
+    expect(JSON.parse("1E+2")).toBe(100);
+});
+
+test("repeated and duplicate keys", () => {
+    const array = JSON.parse('[{"a":1,"b":2},{"a":3,"b":4},{"b":5,"a":6}]');
+    expect(array).toEqual([
+        { a: 1, b: 2 },
+        { a: 3, b: 4 },
+        { b: 5, a: 6 },
+    ]);
+    expect(Object.keys(array[2])).toEqual(["b", "a"]);
+
+    const object = JSON.parse('{"a":1,"b":2,"a":3}');
+    expect(Object.keys(object)).toEqual(["a", "b"]);
+    expect(object.a).toBe(3);
+
+    expect(JSON.parse('{"0":"x","1":"y"}')[1]).toBe("y");
+    expect(JSON.parse('{"__proto__":1}').__proto__).toBe(1);
+});
+
+test("deeply nested arrays throw instead of crashing", () => {
+    const depth = 1000000;
+    expect(() => JSON.parse("[".repeat(depth) + "]".repeat(depth))).toThrow();
+});
+
+test("malformed numbers and literals", () => {
+    const texts = ["01", "-", "1.", ".5", "+1", "1e", "1e+", "tru", "nul", "[1,]", '{"a":1,}', '{"a" 1}', '"\\x"', '"a', "1 2"];
+    texts.forEach(text => {
+        expect(() => JSON.parse(text)).toThrow(SyntaxError);
+    });
+});
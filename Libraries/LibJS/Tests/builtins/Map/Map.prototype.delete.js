@@ -82,4 +82,38 @@ describe("modification with active iterators", () => {
         expect(iterator.next()).toBeIteratorResultDone();
         expect(iterator.next()).toBeIteratorResultDone();
     });
+
+    test("deleting most elements while iterating keeps the iterator in place", () => {
+        const map = new Map();
+        for (let i = 0; i < 1000; ++i) map.set(i, i);
+
+        const iterator = map.keys();
+        for (let i = 0; i < 500; ++i) expect(iterator.next()).toBeIteratorResultWithValue(i);
+
+        for (let i = 0; i < 1000; ++i) {
+            if (i % 100 !== 0) expect(map.delete(i)).toBeTrue();
+        }
+        expect(map).toHaveSize(10);
+
+        map.set(1000, 1000);
+
+        const remaining = [];
+        for (let result = iterator.next(); !result.done; result = iterator.next()) remaining.push(result.value);
+        expect(remaining).toEqual([500, 600, 700, 800, 900, 1000]);
+    });
+
+    test("deleted keys can be re-added at the end", () => {
+        const map = new Map();
+        for (let i = 0; i < 100; ++i) map.set(i, i);
+        for (let i = 0; i < 100; i += 2) map.delete(i);
+        map.set(0, "zero");
+
+        const keys = Array.from(map.keys());
+        expect(keys).toHaveLength(51);
+        expect(keys[0]).toBe(1);
+        expect(keys[50]).toBe(0);
+        expect(map.get(0)).toBe("zero");
+        expect(map.get(2)).toBeUndefined();
+        expect(map.has(99)).toBeTrue();
+    });
 });
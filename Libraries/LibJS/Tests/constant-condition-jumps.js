@@ -0,0 +1,50 @@
+test("branches on non-boolean constant conditions", () => {
+    let taken = [];
+    if (1) taken.push("1");
+    if (0) taken.push("0");
+    if ("x") taken.push("x");
+    if ("") taken.push("empty string");
+    if (null) taken.push("null");
+    if (undefined) taken.push("undefined");
+    if (NaN) taken.push("NaN");
+    expect(taken).toEqual(["1", "x"]);
+});
+
+test("loops on constant conditions", () => {
+    let iterations = 0;
+    while (1) {
+        if (++iterations === 3) break;
+    }
+    expect(iterations).toBe(3);
+
+    while (0) iterations = -1;
+    expect(iterations).toBe(3);
+
+    do {
+        ++iterations;
+    } while ("");
+    expect(iterations).toBe(4);
+});
+
+test("jumps through empty blocks", () => {
+    function f(a, b) {
+        let result = 0;
+        if (a) {
+            if (b) {
+            } else {
+            }
+        } else {
+            for (;;) {
+                break;
+            }
+        }
+        try {
+            result = 1;
+        } finally {
+        }
+        return result;
+    }
+    expect(f(true, true)).toBe(1);
+    expect(f(true, false)).toBe(1);
+    expect(f(false, false)).toBe(1);
+});
@@ -21,3 +21,18 @@ test("non-numeric values", () => {
     expect(~Infinity).toBe(-1);
     expect(~-Infinity).toBe(-1);
 });
+
+test("unary operators on int32 values that are not known at compile time", () => {
+    const bitwiseNot = a => ~a;
+    const negate = a => -a;
+    const plus = a => +a;
+
+    expect(bitwiseNot(0)).toBe(-1);
+    expect(bitwiseNot(-2147483648)).toBe(2147483647);
+    expect(negate(5)).toBe(-5);
+    expect(negate(0)).toBe(-0);
+    expect(negate(-2147483648)).toBe(2147483648);
+    expect(plus(5)).toBe(5);
+    expect(plus(1.5)).toBe(1.5);
+    expect(plus("5")).toBe(5);
+});
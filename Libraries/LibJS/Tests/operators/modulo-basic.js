@@ -37,3 +37,15 @@ test("basic functionality", () => {
     expect(undefined % undefined).toBeNaN();
     expect(null % null).toBeNaN();
 });
+
+test("int32 operands that are not known at compile time", () => {
+    const modulo = (a, b) => a % b;
+    expect(modulo(10, 3)).toBe(1);
+    expect(modulo(0, 5)).toBe(0);
+    expect(modulo(-4, 2)).toBe(-0);
+    expect(modulo(-7, 3)).toBe(-1);
+    expect(modulo(7, -3)).toBe(1);
+    expect(modulo(1, 0)).toBeNaN();
+    expect(modulo(-2147483648, -1)).toBe(-0);
+    expect(modulo(2147483647, 2)).toBe(1);
+});
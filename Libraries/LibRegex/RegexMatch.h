@@ -334,6 +334,23 @@ public:
             });
     }
 
+    // Only meaningful without the Unicode flag, where code unit and code point indices coincide.
+    Optional<size_t> find_index_of_next_code_unit(u32 code_unit, size_t start_code_unit_index) const
+    {
+        VERIFY(!unicode());
+        return m_view.visit(
+            [&](Utf16View const& view) -> Optional<size_t> {
+                if (code_unit > 0xffff)
+                    return {};
+                return view.find_code_unit_offset(static_cast<char16_t>(code_unit), start_code_unit_index);
+            },
+            [&](StringView const& view) -> Optional<size_t> {
+                if (code_unit > 0xff)
+                    return {};
+                return view.find(static_cast<char>(code_unit), start_code_unit_index);
+            });
+    }
+
 private:
     NO_UNIQUE_ADDRESS Variant<StringView, Utf16View> m_view { StringView {} };
     NO_UNIQUE_ADDRESS bool m_unicode { false };
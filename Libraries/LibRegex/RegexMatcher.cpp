@@ -4,9 +4,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/AllOf.h>
 #include <AK/BinarySearch.h>
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
+#include <AK/CharacterTypes.h>
 #include <AK/Debug.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
@@ -152,6 +154,9 @@ ByteString Regex<Parser>::error_string(Optional<ByteString> message) const
     return eb.to_byte_string();
 }
 
+static constexpr size_t c_matches_before_compiling_compares = 16;
+static constexpr size_t c_max_bytecode_size_for_compiled_compares = 16 * KiB;
+
 template<typename Parser>
 RegexResult Matcher<Parser>::match(RegexStringView view, Optional<typename ParserTraits<Parser>::OptionsType> regex_options) const
 {
@@ -184,6 +189,10 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     input.regex_options = m_regex_options | regex_options.value_or({}).value();
     input.start_offset = m_pattern->start_offset;
+
+    if (!m_ascii_compare_tables_are_compiled && ++m_match_count >= c_matches_before_compiling_compares)
+        compile_ascii_compare_tables(input.regex_options);
+
     size_t lines_to_skip = 0;
 
     bool unicode = input.regex_options.has_flag_set(AllFlags::Unicode) || input.regex_options.has_flag_set(AllFlags::UnicodeSets);
@@ -242,6 +251,51 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         return -1;
     };
 
+    // When every match has to start with a known code unit (or literal), scan for it with a vectorized find
+    // instead of attempting a match at each position in between.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    Optional<u32> first_code_unit;
+    if (literal_prefix.has_value()) {
+        first_code_unit = literal_prefix->first();
+    } else if (auto const& starting_ranges = m_pattern->parser_result.optimization_data.starting_ranges; starting_ranges.size() == 1 && starting_ranges.first().from == starting_ranges.first().to) {
+        first_code_unit = starting_ranges.first().from;
+    }
+    auto const prefix_is_ascii = literal_prefix.has_value()
+        ? all_of(*literal_prefix, [](u16 code_unit) { return is_ascii(code_unit); })
+        : first_code_unit.has_value() && is_ascii(*first_code_unit);
+
+    auto can_skip_to_candidates = [&](RegexStringView const& view) {
+        if (!first_code_unit.has_value() || !continue_search || only_start_of_line || view.unicode())
+            return false;
+        if (input.regex_options.has_flag_set(AllFlags::Insensitive))
+            return false;
+        // Byte-wise views can't contain non-ASCII code units.
+        return view.is_u16_view() || prefix_is_ascii;
+    };
+
+    auto find_next_candidate = [&](RegexStringView const& view, size_t index) -> Optional<size_t> {
+        for (;;) {
+            auto candidate = view.find_index_of_next_code_unit(*first_code_unit, index);
+            if (!candidate.has_value() || !literal_prefix.has_value())
+                return candidate;
+
+            if (*candidate + literal_prefix->size() > view.length_in_code_units())
+                return {};
+
+            bool matches_prefix = true;
+            for (size_t i = 1; i < literal_prefix->size(); ++i) {
+                if (view.unicode_aware_code_point_at(*candidate + i) != literal_prefix->at(i)) {
+                    matches_prefix = false;
+                    break;
+                }
+            }
+            if (matches_prefix)
+                return candidate;
+
+            index = *candidate + 1;
+        }
+    };
+
     for (auto const& view : views) {
         input.in_the_middle_of_a_line = false;
         if (lines_to_skip != 0) {
@@ -264,6 +318,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.string_position_in_code_units = view_index;
         }
         bool succeeded = false;
+        auto const skip_to_candidates = can_skip_to_candidates(view);
 
         if (view_index == view_length && m_pattern->parser_result.match_length_minimum == 0) {
             // Run the code until it tries to consume something.
@@ -300,6 +355,16 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                     break;
             }
 
+            if (skip_to_candidates && view_index < view_length) {
+                auto candidate = find_next_candidate(input.view, view_index);
+                if (!candidate.has_value())
+                    break;
+                if (*candidate != view_index) {
+                    view_index = *candidate;
+                    input.in_the_middle_of_a_line = true;
+                }
+            }
+
             // FIXME: More performant would be to know the remaining minimum string
             //        length needed to match from the current position onwards within
             //        the vm. Add new OpCode for MinMatchLengthFromSp with the value of
@@ -507,6 +572,27 @@ private:
     Node* m_last { nullptr };
 };
 
+static constexpr size_t c_max_backtracks_before_switching_to_pike_vm = 10'000;
+
+// Returns nothing if the current character isn't covered by the table, in which case the compare has to be interpreted.
+static Optional<ExecutionResult> execute_compiled_compare(Array<u64, 2> const& table, MatchInput const& input, MatchState& state)
+{
+    if (state.string_position_in_code_units >= input.view.length_in_code_units())
+        return {};
+
+    auto ch = input.view.unicode_aware_code_point_at(state.string_position_in_code_units);
+    if (!is_ascii(ch))
+        return {};
+
+    state.string_position_before_match = state.string_position;
+    if (!(table[ch / 64] & (1ull << (ch % 64))))
+        return ExecutionResult::Failed_ExecuteLowPrioForks;
+
+    ++state.string_position;
+    ++state.string_position_in_code_units;
+    return ExecutionResult::Continue;
+}
+
 struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
     static constexpr unsigned hash(u64 value)
     {
@@ -564,8 +650,22 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
     size_t recursion_level = 0;
 #endif
 
+    // Backtracking is fast for the common case, but exponential for patterns like /(a+)+b/. Once it has clearly
+    // gone off the rails, restart from the initial state on the Pike VM, which produces the same match in linear time.
+    Optional<MatchState> initial_state;
+    if (m_pattern->parser_result.optimization_data.can_use_pike_vm)
+        initial_state = state;
+    size_t backtrack_count = 0;
+    auto should_switch_to_pike_vm = [&] {
+        return initial_state.has_value() && ++backtrack_count > c_max_backtracks_before_switching_to_pike_vm;
+    };
+
     auto& bytecode = m_pattern->parser_result.bytecode.template get<FlatByteCode>();
 
+    auto const* ascii_compare_tables = m_ascii_compare_tables_are_compiled && m_ascii_compare_tables_options.value() == input.regex_options.value()
+        ? &m_ascii_compare_tables
+        : nullptr;
+
     for (;;) {
         auto& opcode = bytecode.get_opcode(state);
         auto const opcode_size = opcode.size();
@@ -580,7 +680,12 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
             --input.fail_counter;
             result = ExecutionResult::Failed_ExecuteLowPrioForks;
         } else {
-            result = opcode.execute(input, state);
+            Optional<ExecutionResult> compiled_result;
+            if (ascii_compare_tables && (opcode.opcode_id() == OpCodeId::Compare || opcode.opcode_id() == OpCodeId::CompareSimple)) {
+                if (auto table = ascii_compare_tables->find(state.instruction_position); table != ascii_compare_tables->end())
+                    compiled_result = execute_compiled_compare(table->value, input, state);
+            }
+            result = compiled_result.has_value() ? *compiled_result : opcode.execute(input, state);
         }
 
 #if REGEX_DEBUG
@@ -643,6 +748,11 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
         case ExecutionResult::Succeeded:
             return ExecuteResult::Matched;
         case ExecutionResult::Failed: {
+            if (should_switch_to_pike_vm()) {
+                state = initial_state.release_value();
+                input.fork_to_replace.clear();
+                return execute_pike_vm(input, state, operations);
+            }
             bool found = false;
             while (!states_to_try_next.is_empty()) {
                 state = states_to_try_next.take_last();
@@ -658,6 +768,11 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
             return ExecuteResult::DidNotMatch;
         }
         case ExecutionResult::Failed_ExecuteLowPrioForks: {
+            if (should_switch_to_pike_vm()) {
+                state = initial_state.release_value();
+                input.fork_to_replace.clear();
+                return execute_pike_vm(input, state, operations);
+            }
             bool found = false;
             while (!states_to_try_next.is_empty()) {
                 state = states_to_try_next.take_last();
@@ -676,6 +791,11 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
             continue;
         }
         case ExecutionResult::Failed_ExecuteLowPrioForksButNoFurtherPossibleMatches: {
+            if (should_switch_to_pike_vm()) {
+                state = initial_state.release_value();
+                input.fork_to_replace.clear();
+                return execute_pike_vm(input, state, operations);
+            }
             bool found = false;
             while (!states_to_try_next.is_empty()) {
                 state = states_to_try_next.take_last();
@@ -699,6 +819,272 @@ Matcher<Parser>::ExecuteResult Matcher<Parser>::execute(MatchInput const& input,
     VERIFY_NOT_REACHED();
 }
 
+static bool only_looks_at_current_character(Vector<CompareTypeAndValuePair> const& compares)
+{
+    return all_of(compares, [](auto const& compare) {
+        switch (compare.type) {
+        case CharacterCompareType::Inverse:
+        case CharacterCompareType::TemporaryInverse:
+        case CharacterCompareType::AnyChar:
+        case CharacterCompareType::Char:
+        case CharacterCompareType::CharClass:
+        case CharacterCompareType::CharRange:
+        case CharacterCompareType::LookupTable:
+        case CharacterCompareType::Property:
+        case CharacterCompareType::GeneralCategory:
+        case CharacterCompareType::Script:
+        case CharacterCompareType::ScriptExtension:
+        case CharacterCompareType::And:
+        case CharacterCompareType::Or:
+        case CharacterCompareType::EndAndOr:
+        case CharacterCompareType::Subtract:
+            return true;
+        default:
+            return false;
+        }
+    });
+}
+
+template<class Parser>
+void Matcher<Parser>::compile_ascii_compare_tables(AllOptions options) const
+{
+    m_ascii_compare_tables_are_compiled = true;
+    m_ascii_compare_tables_options = options;
+    m_ascii_compare_tables.clear();
+
+    auto& bytecode = m_pattern->parser_result.bytecode.template get<FlatByteCode>();
+    if (bytecode.size() > c_max_bytecode_size_for_compiled_compares)
+        return;
+
+    // Rather than duplicating the compare semantics (case folding, dot-all, inversions...), run each compare once
+    // against every ASCII character and record the outcome.
+    auto const unicode = options.has_flag_set(AllFlags::Unicode) || options.has_flag_set(AllFlags::UnicodeSets);
+    MatchInput input;
+    input.regex_options = options;
+
+    MatchState state { m_pattern->parser_result.capture_groups_count };
+    for (size_t instruction_position = 0; instruction_position < bytecode.size();) {
+        state.instruction_position = instruction_position;
+        auto& opcode = bytecode.get_opcode(state);
+        auto const opcode_id = opcode.opcode_id();
+        instruction_position += opcode.size();
+
+        Vector<CompareTypeAndValuePair> flat_compares;
+        if (opcode_id == OpCodeId::Compare)
+            flat_compares = to<OpCode_Compare>(opcode).flat_compares();
+        else if (opcode_id == OpCodeId::CompareSimple)
+            flat_compares = to<OpCode_CompareSimple>(opcode).flat_compares();
+        else
+            continue;
+
+        if (flat_compares.is_empty() || !only_looks_at_current_character(flat_compares))
+            continue;
+
+        Array<u64, 2> table {};
+        for (u32 ch = 0; ch < 128; ++ch) {
+            char character = static_cast<char>(ch);
+            RegexStringView view { StringView { &character, 1 } };
+            view.set_unicode(unicode);
+            input.view = view;
+
+            MatchState trial_state { m_pattern->parser_result.capture_groups_count };
+            trial_state.instruction_position = state.instruction_position;
+            auto& trial_opcode = bytecode.get_opcode(trial_state);
+            if (trial_opcode.execute(input, trial_state) == ExecutionResult::Continue && trial_state.string_position == 1)
+                table[ch / 64] |= 1ull << (ch % 64);
+        }
+        m_ascii_compare_tables.set(state.instruction_position, table);
+    }
+}
+
+// Two threads at the same position behave identically if they agree on this; captures don't matter as the
+// pattern has no backreferences, and a checkpoint only matters as far as whether it was set at this position.
+struct PikeVMStateKey {
+    static u8 classify_checkpoint(MatchState const& state, u64 checkpoint)
+    {
+        return checkpoint == 0 ? 0 : (checkpoint == state.string_position + 1 ? 1 : 2);
+    }
+
+    static u64 hash_of(MatchState const& state)
+    {
+        u64 hash = 0xcbf29ce484222325;
+        auto combine = [&hash](u64 value) {
+            hash ^= value + 0x9e3779b97f4a7c15 + (hash << 6) + (hash >> 2);
+        };
+
+        combine(state.instruction_position);
+        combine(state.repetition_marks.size());
+        for (auto mark : state.repetition_marks)
+            combine(mark);
+        combine(state.checkpoints.size());
+        for (auto checkpoint : state.checkpoints)
+            combine(classify_checkpoint(state, checkpoint));
+
+        return hash;
+    }
+
+    PikeVMStateKey(MatchState const& state, u64 hash)
+        : hash(hash)
+        , instruction_position(state.instruction_position)
+    {
+        repetition_marks.ensure_capacity(state.repetition_marks.size());
+        for (auto mark : state.repetition_marks)
+            repetition_marks.unchecked_append(mark);
+        checkpoints.ensure_capacity(state.checkpoints.size());
+        for (auto checkpoint : state.checkpoints)
+            checkpoints.unchecked_append(classify_checkpoint(state, checkpoint));
+    }
+
+    bool matches(MatchState const& state, u64 state_hash) const
+    {
+        if (hash != state_hash || instruction_position != state.instruction_position)
+            return false;
+        if (repetition_marks.size() != state.repetition_marks.size() || checkpoints.size() != state.checkpoints.size())
+            return false;
+        for (size_t i = 0; i < repetition_marks.size(); ++i) {
+            if (repetition_marks[i] != state.repetition_marks[i])
+                return false;
+        }
+        for (size_t i = 0; i < checkpoints.size(); ++i) {
+            if (checkpoints[i] != classify_checkpoint(state, state.checkpoints[i]))
+                return false;
+        }
+        return true;
+    }
+
+    bool operator==(PikeVMStateKey const&) const = default;
+
+    u64 hash { 0 };
+    size_t instruction_position { 0 };
+    Vector<u64> repetition_marks;
+    Vector<u8> checkpoints;
+};
+
+struct PikeVMStateKeyTraits : public DefaultTraits<PikeVMStateKey> {
+    static unsigned hash(PikeVMStateKey const& key) { return u64_hash(key.hash); }
+};
+
+// Returns false if an equivalent thread was already seen at this position. The hash only narrows down the candidates,
+// as two distinct states colliding must not cause one of them to be dropped.
+static bool add_pike_vm_state(HashTable<PikeVMStateKey, PikeVMStateKeyTraits>& seen_states, MatchState const& state)
+{
+    auto hash = PikeVMStateKey::hash_of(state);
+    if (seen_states.find(u64_hash(hash), [&](auto const& candidate) { return candidate.matches(state, hash); }) != seen_states.end())
+        return false;
+    seen_states.set(PikeVMStateKey { state, hash });
+    return true;
+}
+
+template<class Parser>
+Matcher<Parser>::ExecuteResult Matcher<Parser>::execute_pike_vm(MatchInput const& input, MatchState& state, size_t& operations) const
+{
+    auto& bytecode = m_pattern->parser_result.bytecode.template get<FlatByteCode>();
+
+    // All threads are kept in priority order, i.e. the order the backtracker would have tried them in.
+    // A thread that consumed more than one character (e.g. through a string compare) keeps its place in
+    // the list without running until the position catches up with it, so the order is never disturbed.
+    Vector<MatchState> threads;
+    Vector<MatchState> next_threads;
+    Vector<MatchState> forks_to_try_next;
+    HashTable<PikeVMStateKey, PikeVMStateKeyTraits> seen_states;
+    Optional<MatchState> best_match;
+
+    threads.append(state);
+
+    while (!threads.is_empty()) {
+        auto position = NumericLimits<size_t>::max();
+        for (auto const& thread : threads)
+            position = min(position, thread.string_position);
+        seen_states.clear_with_capacity();
+
+        bool matched_at_this_position = false;
+        for (auto& thread : threads) {
+            if (thread.string_position > position) {
+                next_threads.append(move(thread));
+                continue;
+            }
+
+            // Follow the thread and everything it forks into, depth first, until each one consumes input, fails or matches.
+            forks_to_try_next.append(move(thread));
+            while (!forks_to_try_next.is_empty() && !matched_at_this_position) {
+                auto current = forks_to_try_next.take_last();
+                for (;;) {
+                    auto& opcode = bytecode.get_opcode(current);
+                    auto const opcode_size = opcode.size();
+                    ++operations;
+
+                    switch (opcode.opcode_id()) {
+                    case OpCodeId::Compare:
+                    case OpCodeId::CompareSimple:
+                    case OpCodeId::ForkJump:
+                    case OpCodeId::ForkStay:
+                    case OpCodeId::ForkReplaceJump:
+                    case OpCodeId::ForkReplaceStay:
+                    case OpCodeId::ForkIf:
+                    case OpCodeId::JumpNonEmpty:
+                        if (!add_pike_vm_state(seen_states, current))
+                            goto thread_done;
+                        break;
+                    default:
+                        break;
+                    }
+
+                    auto result = opcode.execute(input, current);
+                    current.instruction_position += opcode_size;
+
+                    // Replacing forks only serves to forget alternatives that can't match anyway, the lockstep
+                    // execution doesn't keep those around in the first place.
+                    input.fork_to_replace.clear();
+
+                    switch (result) {
+                    case ExecutionResult::Continue:
+                        if (current.string_position > position) {
+                            next_threads.append(move(current));
+                            goto thread_done;
+                        }
+                        continue;
+                    case ExecutionResult::Fork_PrioHigh: {
+                        forks_to_try_next.append(current);
+                        current.instruction_position = current.fork_at_position;
+                        continue;
+                    }
+                    case ExecutionResult::Fork_PrioLow: {
+                        forks_to_try_next.append(current);
+                        forks_to_try_next.last().instruction_position = current.fork_at_position;
+                        continue;
+                    }
+                    case ExecutionResult::Succeeded:
+                        // Everything after this thread has a lower priority, so it can never win against this match.
+                        best_match = move(current);
+                        matched_at_this_position = true;
+                        goto thread_done;
+                    case ExecutionResult::Failed:
+                    case ExecutionResult::Failed_ExecuteLowPrioForks:
+                    case ExecutionResult::Failed_ExecuteLowPrioForksButNoFurtherPossibleMatches:
+                        goto thread_done;
+                    }
+                    VERIFY_NOT_REACHED();
+                }
+            thread_done:;
+            }
+
+            if (matched_at_this_position) {
+                forks_to_try_next.clear_with_capacity();
+                break;
+            }
+        }
+
+        swap(threads, next_threads);
+        next_threads.clear_with_capacity();
+    }
+
+    if (!best_match.has_value())
+        return ExecuteResult::DidNotMatch;
+
+    state = best_match.release_value();
+    return ExecuteResult::Matched;
+}
+
 template class Matcher<PosixBasicParser>;
 template class Regex<PosixBasicParser>;
 
@@ -11,8 +11,10 @@
 #include "RegexOptions.h"
 #include "RegexParser.h"
 
+#include <AK/Array.h>
 #include <AK/Forward.h>
 #include <AK/GenericLexer.h>
+#include <AK/HashMap.h>
 #include <AK/Vector.h>
 #include <ctype.h>
 
@@ -77,9 +79,19 @@ private:
         DidNotMatchAndNoFurtherPossibleMatchesInView,
     };
     ExecuteResult execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    ExecuteResult execute_pike_vm(MatchInput const& input, MatchState& state, size_t& operations) const;
+
+    void compile_ascii_compare_tables(AllOptions) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
+
+    // Once a pattern has been matched often enough, compares that only look at the current character get their
+    // outcome for every ASCII character precomputed, keyed by instruction position.
+    mutable size_t m_match_count { 0 };
+    mutable bool m_ascii_compare_tables_are_compiled { false };
+    mutable AllOptions m_ascii_compare_tables_options {};
+    mutable HashMap<size_t, Array<u64, 2>> m_ascii_compare_tables;
 };
 
 template<class Parser>
@@ -241,6 +253,7 @@ private:
     void attempt_rewrite_dot_star_sequences_as_seek(BasicBlockList const&);
     void rewrite_simple_compares(BasicBlockList const&);
     void fill_optimization_data(BasicBlockList const&);
+    void fill_pike_vm_eligibility();
 };
 
 // free standing functions for match, search and has_match
@@ -388,6 +388,7 @@ void Regex<Parser>::run_optimization_passes()
     rewrite_simple_compares(blocks);
 
     fill_optimization_data(split_basic_blocks(parser_result.bytecode.template get<ByteCode>()));
+    fill_pike_vm_eligibility();
 }
 
 struct StaticallyInterpretedCompares {
@@ -564,6 +565,31 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
 
     auto& bytecode = parser_result.bytecode.get<ByteCode>();
 
+    // A leading string compare gives us both the first character and a literal the matcher can scan for.
+    auto fill_literal_prefix = [&](Vector<CompareTypeAndValuePair> const& flat_compares) {
+        if (flat_compares.size() != 1 || flat_compares.first().type != CharacterCompareType::String)
+            return false;
+
+        auto string = bytecode.get_u16_string(flat_compares.first().value);
+        if (string.is_empty())
+            return false;
+
+        Vector<u16> code_units;
+        code_units.ensure_capacity(string.length_in_code_units());
+        for (size_t i = 0; i < string.length_in_code_units(); ++i)
+            code_units.unchecked_append(string.code_unit_at(i));
+        parser_result.optimization_data.literal_prefix = move(code_units);
+
+        // Without the Unicode flag, the first code unit may be half of a surrogate pair; stay away from that,
+        // and from case folding beyond ASCII.
+        u32 first_code_unit = string.code_unit_at(0);
+        if (is_ascii(first_code_unit)) {
+            parser_result.optimization_data.starting_ranges.append({ first_code_unit, first_code_unit });
+            parser_result.optimization_data.starting_ranges_insensitive.append({ to_ascii_lowercase(first_code_unit), to_ascii_lowercase(first_code_unit) });
+        }
+        return true;
+    };
+
     auto state = MatchState::only_for_enumeration();
     auto block = blocks.first();
     for (state.instruction_position = block.start; state.instruction_position < block.end;) {
@@ -574,6 +600,9 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
             if (compare.arguments_count() == 0)
                 return; // This matches 'nothing', so there are no starting ranges that can satisfy it.
             auto flat_compares = compare.flat_compares();
+            if (fill_literal_prefix(flat_compares))
+                return;
+
             StaticallyInterpretedCompares compares;
             if (!interpret_compares(flat_compares, compares))
                 return; // No idea, the bytecode is too complex.
@@ -595,6 +624,9 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
         case OpCodeId::CompareSimple: {
             auto& compare = to<OpCode_CompareSimple>(opcode);
             auto flat_compares = compare.flat_compares();
+            if (fill_literal_prefix(flat_compares))
+                return;
+
             StaticallyInterpretedCompares compares;
             if (!interpret_compares(flat_compares, compares))
                 return; // No idea, the bytecode is too complex.
@@ -629,6 +661,45 @@ void Regex<Parser>::fill_optimization_data(BasicBlockList const& blocks)
     }
 }
 
+template<typename Parser>
+void Regex<Parser>::fill_pike_vm_eligibility()
+{
+    // The Pike VM runs all threads in lockstep and merges the ones that reach the same state, which is only
+    // valid if the future of a thread doesn't depend on its captures or on positions saved by lookarounds.
+    auto& bytecode = parser_result.bytecode.get<ByteCode>();
+    auto const bytecode_size = bytecode.size();
+
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = 0; state.instruction_position < bytecode_size;) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare:
+        case OpCodeId::CompareSimple: {
+            auto flat_compares = opcode.opcode_id() == OpCodeId::Compare
+                ? to<OpCode_Compare>(opcode).flat_compares()
+                : to<OpCode_CompareSimple>(opcode).flat_compares();
+            for (auto const& compare : flat_compares) {
+                if (compare.type == CharacterCompareType::Reference || compare.type == CharacterCompareType::NamedReference)
+                    return;
+            }
+            break;
+        }
+        case OpCodeId::FailForks:
+        case OpCodeId::PopSaved:
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::RSeekTo:
+            return;
+        default:
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+
+    parser_result.optimization_data.can_use_pike_vm = true;
+}
+
 template<typename Parser>
 typename Regex<Parser>::BasicBlockList Regex<Parser>::split_basic_blocks(ByteCode const& bytecode)
 {
@@ -67,7 +67,11 @@ public:
             // If populated, the pattern only accepts strings that start with a character in these ranges.
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
+            // If populated, every match starts with these code units.
+            Optional<Vector<u16>> literal_prefix;
             bool only_start_of_line = false;
+            // Set if the bytecode has no backreferences, lookarounds or seeks, so it can be run on the Pike VM.
+            bool can_use_pike_vm = false;
         } optimization_data {};
     };
 
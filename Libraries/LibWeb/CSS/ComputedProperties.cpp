@@ -60,6 +60,24 @@ void ComputedProperties::visit_edges(Visitor& visitor)
     Base::visit_edges(visitor);
 }
 
+GC::Ref<ComputedProperties> ComputedProperties::clone() const
+{
+    auto clone = heap().allocate<ComputedProperties>();
+    clone->m_property_values = m_property_values;
+    clone->m_property_important = m_property_important;
+    clone->m_property_inherited = m_property_inherited;
+    clone->m_animated_property_inherited = m_animated_property_inherited;
+    clone->m_animated_property_result_of_transition = m_animated_property_result_of_transition;
+    clone->m_animated_property_values = m_animated_property_values;
+    clone->m_display_before_box_type_transformation = m_display_before_box_type_transformation;
+    clone->m_math_depth = m_math_depth;
+    clone->m_cached_computed_font_list = m_cached_computed_font_list;
+    clone->m_cached_first_available_computed_font = m_cached_first_available_computed_font;
+    clone->m_line_height = m_line_height;
+    clone->m_attempted_pseudo_class_matches = m_attempted_pseudo_class_matches;
+    return clone;
+}
+
 bool ComputedProperties::is_property_important(PropertyID property_id) const
 {
     VERIFY(property_id >= first_longhand_property_id && property_id <= last_longhand_property_id);
@@ -48,6 +48,9 @@ public:
 
     virtual ~ComputedProperties() override;
 
+    // Used when another element is known to compute to the exact same style, see StyleComputer's style sharing.
+    [[nodiscard]] GC::Ref<ComputedProperties> clone() const;
+
     template<typename Callback>
     inline void for_each_property(Callback callback) const
     {
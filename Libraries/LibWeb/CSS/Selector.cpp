@@ -134,6 +134,52 @@ Selector::Selector(Vector<CompoundSelector>&& compound_selectors)
     collect_ancestor_hashes();
 
     m_can_use_fast_matches = can_selector_use_fast_matches(*this);
+    if (m_can_use_fast_matches)
+        compile_for_fast_matches();
+}
+
+// Lower is cheaper. These only need to be a rough estimate of how much work matching each kind of simple selector is.
+static u8 fast_matches_cost(Selector::SimpleSelector const& simple_selector)
+{
+    switch (simple_selector.type) {
+    case Selector::SimpleSelector::Type::Id:
+        return 0;
+    case Selector::SimpleSelector::Type::Class:
+        return 1;
+    case Selector::SimpleSelector::Type::TagName:
+        return 2;
+    case Selector::SimpleSelector::Type::Universal:
+        return 3;
+    case Selector::SimpleSelector::Type::Attribute:
+        return 4;
+    default:
+        return 5;
+    }
+}
+
+void Selector::compile_for_fast_matches()
+{
+    static constexpr u8 max_cost = 5;
+
+    m_compiled_compound_selectors.ensure_capacity(m_compound_selectors.size());
+    for (auto const& compound_selector : m_compound_selectors.in_reverse()) {
+        CompiledCompoundSelector compiled_compound_selector {
+            .combinator = compound_selector.combinator,
+            .first_simple_selector_index = static_cast<u32>(m_compiled_simple_selectors.size()),
+            .simple_selector_count = static_cast<u32>(compound_selector.simple_selectors.size()),
+        };
+
+        // Every simple selector fast_matches() supports is a side-effect free check of a single element (apart from
+        // recording which pseudo-classes were attempted), so the order they run in doesn't affect the result.
+        for (u8 cost = 0; cost <= max_cost; ++cost) {
+            for (auto const& simple_selector : compound_selector.simple_selectors) {
+                if (fast_matches_cost(simple_selector) == cost)
+                    m_compiled_simple_selectors.append(&simple_selector);
+            }
+        }
+
+        m_compiled_compound_selectors.append(compiled_compound_selector);
+    }
 }
 
 void Selector::collect_ancestor_hashes()
@@ -227,6 +227,20 @@ public:
     auto const& ancestor_hashes() const { return m_ancestor_hashes; }
 
     bool can_use_fast_matches() const { return m_can_use_fast_matches; }
+
+    // The match program used by fast_matches(). Compound selectors are listed right-to-left, starting with the subject,
+    // and each one's simple selectors are ordered so that the cheapest checks run first.
+    struct CompiledCompoundSelector {
+        // How to get from this compound selector's element to the next one's.
+        Combinator combinator { Combinator::None };
+        u32 first_simple_selector_index { 0 };
+        u32 simple_selector_count { 0 };
+    };
+    ReadonlySpan<CompiledCompoundSelector> compiled_compound_selectors() const { return m_compiled_compound_selectors; }
+    ReadonlySpan<SimpleSelector const*> compiled_simple_selectors(CompiledCompoundSelector const& compound_selector) const
+    {
+        return m_compiled_simple_selectors.span().slice(compound_selector.first_simple_selector_index, compound_selector.simple_selector_count);
+    }
     bool can_use_ancestor_filter() const { return m_can_use_ancestor_filter; }
 
     size_t sibling_invalidation_distance() const;
@@ -248,6 +262,10 @@ private:
     PseudoClassBitmap m_contained_pseudo_classes;
 
     void collect_ancestor_hashes();
+    void compile_for_fast_matches();
+
+    Vector<CompiledCompoundSelector> m_compiled_compound_selectors;
+    Vector<SimpleSelector const*> m_compiled_simple_selectors;
 
     Array<u32, 8> m_ancestor_hashes;
 };
@@ -1318,10 +1318,10 @@ static bool fast_matches_simple_selector(CSS::Selector::SimpleSelector const& si
     }
 }
 
-static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
+static bool fast_matches_compound_selector(CSS::Selector const& selector, CSS::Selector::CompiledCompoundSelector const& compound_selector, DOM::Element const& element, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
-    for (auto const& simple_selector : compound_selector.simple_selectors) {
-        if (!fast_matches_simple_selector(simple_selector, element, shadow_host, context))
+    for (auto const* simple_selector : selector.compiled_simple_selectors(compound_selector)) {
+        if (!fast_matches_simple_selector(*simple_selector, element, shadow_host, context))
             return false;
     }
     return true;
@@ -1329,45 +1329,45 @@ static bool fast_matches_compound_selector(CSS::Selector::CompoundSelector const
 
 bool fast_matches(CSS::Selector const& selector, DOM::Element const& element_to_match, GC::Ptr<DOM::Element const> shadow_host, MatchContext& context)
 {
+    auto compound_selectors = selector.compiled_compound_selectors();
     DOM::Element const* current = &element_to_match;
 
-    ssize_t compound_selector_index = selector.compound_selectors().size() - 1;
+    size_t compound_selector_index = 0;
 
-    if (!fast_matches_compound_selector(selector.compound_selectors().last(), *current, shadow_host, context))
+    if (!fast_matches_compound_selector(selector, compound_selectors[0], *current, shadow_host, context))
         return false;
 
-    // NOTE: If we fail after following a child combinator, we may need to backtrack
-    //       to the last matched descendant. We store the state here.
+    // NOTE: If we fail after following a child combinator, we may need to backtrack to the ancestor that was matched
+    //       by the last descendant combinator, and continue looking for a match above it. We store the state here.
     struct {
         GC::Ptr<DOM::Element const> element;
-        ssize_t compound_selector_index = 0;
+        size_t compound_selector_index = 0;
     } backtrack_state;
 
     for (;;) {
         // NOTE: There should always be a leftmost compound selector without combinator that kicks us out of this loop.
-        VERIFY(compound_selector_index >= 0);
+        VERIFY(compound_selector_index < compound_selectors.size());
 
-        auto const* compound_selector = &selector.compound_selectors()[compound_selector_index];
-
-        switch (compound_selector->combinator) {
+        switch (compound_selectors[compound_selector_index].combinator) {
         case CSS::Selector::Combinator::None:
             return true;
-        case CSS::Selector::Combinator::Descendant:
-            backtrack_state = { current->parent_element(), compound_selector_index };
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+        case CSS::Selector::Combinator::Descendant: {
+            auto const descendant_combinator_index = compound_selector_index++;
             for (current = current->parent_element(); current; current = current->parent_element()) {
-                if (fast_matches_compound_selector(*compound_selector, *current, shadow_host, context))
+                if (fast_matches_compound_selector(selector, compound_selectors[compound_selector_index], *current, shadow_host, context))
                     break;
             }
             if (!current)
                 return false;
+            backtrack_state = { current, descendant_combinator_index };
             break;
+        }
         case CSS::Selector::Combinator::ImmediateChild:
-            compound_selector = &selector.compound_selectors()[--compound_selector_index];
+            ++compound_selector_index;
             current = current->parent_element();
             if (!current)
                 return false;
-            if (!fast_matches_compound_selector(*compound_selector, *current, shadow_host, context)) {
+            if (!fast_matches_compound_selector(selector, compound_selectors[compound_selector_index], *current, shadow_host, context)) {
                 if (backtrack_state.element) {
                     current = backtrack_state.element;
                     compound_selector_index = backtrack_state.compound_selector_index;
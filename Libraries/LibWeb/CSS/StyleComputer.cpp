@@ -133,6 +133,12 @@ void StyleComputer::visit_edges(Visitor& visitor)
 {
     Base::visit_edges(visitor);
     visitor.visit(m_document);
+    for (auto candidate : m_style_sharing_candidates)
+        visitor.visit(candidate);
+    for (auto const& it : m_matched_properties_cache) {
+        visitor.visit(it.key.parent_style);
+        visitor.visit(it.value.cascaded_properties);
+    }
 }
 
 Optional<String> StyleComputer::user_agent_style_sheet_source(StringView name)
@@ -1794,6 +1800,88 @@ GC::Ref<ComputedProperties> StyleComputer::create_document_style() const
     return style;
 }
 
+// Pseudo-classes that only depend on the element's tag, attributes and ancestors, which siblings sharing style have in
+// common. The user action pseudo-classes are included too, as long as neither sibling is in any of those states.
+static bool pseudo_class_allows_style_sharing(PseudoClass pseudo_class)
+{
+    switch (pseudo_class) {
+    case PseudoClass::Active:
+    case PseudoClass::AnyLink:
+    case PseudoClass::Autofill:
+    case PseudoClass::Focus:
+    case PseudoClass::FocusVisible:
+    case PseudoClass::FocusWithin:
+    case PseudoClass::Heading:
+    case PseudoClass::Hover:
+    case PseudoClass::Is:
+    case PseudoClass::Lang:
+    case PseudoClass::Link:
+    case PseudoClass::LocalLink:
+    case PseudoClass::Not:
+    case PseudoClass::Root:
+    case PseudoClass::Target:
+    case PseudoClass::Visited:
+    case PseudoClass::Where:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static bool is_in_user_action_state(DOM::Element const& element)
+{
+    if (element.is_active() || element.is_focused() || element.is_target())
+        return true;
+    auto const& document = element.document();
+    if (auto focused_area = document.focused_area(); focused_area && element.is_inclusive_ancestor_of(*focused_area))
+        return true;
+    if (auto const* hovered_node = document.hovered_node(); hovered_node && (hovered_node == &element || element.is_shadow_including_ancestor_of(*hovered_node)))
+        return true;
+    return false;
+}
+
+// Whether a sibling with the same tag and attributes would end up with exactly the same computed style.
+static bool can_share_style_with_siblings(DOM::Element const& element, ComputedProperties const& computed_properties)
+{
+    if (element.is_shadow_host() || element.assigned_slot_internal() || element.use_pseudo_element().has_value())
+        return false;
+
+    if (element.affected_by_has_pseudo_class_in_subject_position()
+        || element.affected_by_has_pseudo_class_in_non_subject_position()
+        || element.affected_by_has_pseudo_class_with_relative_selector_that_has_sibling_combinator()
+        || element.affected_by_direct_sibling_combinator()
+        || element.affected_by_indirect_sibling_combinator()
+        || element.affected_by_sibling_position_or_count_pseudo_class()
+        || element.affected_by_nth_child_pseudo_class()
+        || element.style_uses_tree_counting_function())
+        return false;
+
+    for (size_t i = 0; i < to_underlying(PseudoClass::__Count); ++i) {
+        auto pseudo_class = static_cast<PseudoClass>(i);
+        if (computed_properties.has_attempted_match_against_pseudo_class(pseudo_class) && !pseudo_class_allows_style_sharing(pseudo_class))
+            return false;
+    }
+
+    // CSS animations are instantiated per element.
+    return computed_properties.animations().is_empty() && computed_properties.animated_property_values().is_empty();
+}
+
+static bool have_same_attributes(DOM::Element const& a, DOM::Element const& b)
+{
+    auto attribute_count = a.attribute_list_size();
+    if (attribute_count != b.attribute_list_size())
+        return false;
+    for (u32 i = 0; i < attribute_count; ++i) {
+        auto const* attribute_a = a.attributes()->item(i);
+        auto const* attribute_b = b.attributes()->item(i);
+        if (attribute_a->local_name() != attribute_b->local_name()
+            || attribute_a->namespace_uri() != attribute_b->namespace_uri()
+            || attribute_a->value() != attribute_b->value())
+            return false;
+    }
+    return true;
+}
+
 GC::Ref<ComputedProperties> StyleComputer::compute_style(DOM::AbstractElement abstract_element, Optional<bool&> did_change_custom_properties) const
 {
     auto& style_scope = abstract_element.style_scope();
@@ -1836,6 +1924,13 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
     ScopeGuard guard { [&abstract_element]() { abstract_element.element().set_needs_style_update(false); } };
 
+    // Only style that is computed from scratch can be shared, as anything else may have to start transitions.
+    bool const may_share_style = m_style_sharing_enabled && mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value() && !abstract_element.computed_properties();
+    if (may_share_style) {
+        if (auto shared_style = share_style_with_previous_sibling_if_possible(abstract_element.element(), did_change_custom_properties))
+            return shared_style;
+    }
+
     // 1. Perform the cascade. This produces the "specified style"
     bool did_match_any_pseudo_element_rules = false;
     PseudoClassBitmap attempted_pseudo_class_matches;
@@ -1843,17 +1938,46 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
 
     auto old_custom_properties = abstract_element.custom_properties();
 
-    // Resolve all the CSS custom properties ("variables") for this element:
-    if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
-        OrderedHashMap<FlyString, StyleProperty> custom_properties;
-        for (auto& layer : matching_rule_set.author_rules) {
-            cascade_custom_properties(abstract_element, layer.rules, custom_properties);
+    Optional<MatchedPropertiesCacheKey> matched_properties_cache_key;
+    if (m_style_sharing_enabled && mode == ComputeStyleMode::Normal && !abstract_element.pseudo_element().has_value())
+        matched_properties_cache_key = this->matched_properties_cache_key(abstract_element, matching_rule_set);
+
+    GC::Ptr<CascadedProperties> cascaded_properties;
+    if (matched_properties_cache_key.has_value()) {
+        if (auto it = m_matched_properties_cache.find(*matched_properties_cache_key); it != m_matched_properties_cache.end()) {
+            ++m_matched_properties_cache_statistics.hits;
+            abstract_element.set_custom_properties(OrderedHashMap<FlyString, StyleProperty> { it->value.custom_properties });
+            if (it->value.uses_var_css_function)
+                abstract_element.element().set_style_uses_var_css_function();
+            cascaded_properties = it->value.cascaded_properties;
+        } else {
+            ++m_matched_properties_cache_statistics.misses;
         }
-        abstract_element.set_custom_properties(move(custom_properties));
     }
 
-    auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
-    auto cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+    if (!cascaded_properties) {
+        // Resolve all the CSS custom properties ("variables") for this element:
+        if (!abstract_element.pseudo_element().has_value() || pseudo_element_supports_property(*abstract_element.pseudo_element(), PropertyID::Custom)) {
+            OrderedHashMap<FlyString, StyleProperty> custom_properties;
+            for (auto& layer : matching_rule_set.author_rules) {
+                cascade_custom_properties(abstract_element, layer.rules, custom_properties);
+            }
+            abstract_element.set_custom_properties(move(custom_properties));
+        }
+
+        auto logical_alias_mapping_context = compute_logical_alias_mapping_context(abstract_element, mode, matching_rule_set);
+        cascaded_properties = compute_cascaded_values(abstract_element, did_match_any_pseudo_element_rules, mode, matching_rule_set, logical_alias_mapping_context, {});
+
+        // attr() is resolved during the cascade, which makes the result specific to this element.
+        if (matched_properties_cache_key.has_value() && !abstract_element.element().style_uses_attr_css_function() && m_matched_properties_cache.size() < max_matched_properties_cache_size) {
+            m_matched_properties_cache.set(matched_properties_cache_key.release_value(),
+                MatchedPropertiesCacheEntry {
+                    .cascaded_properties = *cascaded_properties,
+                    .custom_properties = abstract_element.custom_properties(),
+                    .uses_var_css_function = abstract_element.element().style_uses_var_css_function(),
+                });
+        }
+    }
     abstract_element.set_cascaded_properties(cascaded_properties);
 
     if (mode == ComputeStyleMode::CreatePseudoElementStyleIfNeeded) {
@@ -1885,16 +2009,112 @@ GC::Ptr<ComputedProperties> StyleComputer::compute_style_impl(DOM::AbstractEleme
         }
     }
 
-    auto computed_properties = compute_properties(abstract_element, cascaded_properties);
+    auto computed_properties = compute_properties(abstract_element, *cascaded_properties);
     computed_properties->set_attempted_pseudo_class_matches(attempted_pseudo_class_matches);
 
     if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties) {
         *did_change_custom_properties = true;
     }
 
+    if (may_share_style && can_share_style_with_siblings(abstract_element.element(), computed_properties))
+        m_style_sharing_candidates.set(abstract_element.element());
+
     return computed_properties;
 }
 
+static bool has_presentational_hint_attributes(DOM::Element const& element)
+{
+    bool has_presentational_hints = false;
+    element.for_each_attribute([&](auto& name, auto&) {
+        if (element.is_presentational_hint(name))
+            has_presentational_hints = true;
+        else if (element.supports_dimension_attributes() && (name == HTML::AttributeNames::width || name == HTML::AttributeNames::height))
+            has_presentational_hints = true;
+    });
+    return has_presentational_hints;
+}
+
+Optional<StyleComputer::MatchedPropertiesCacheKey> StyleComputer::matched_properties_cache_key(DOM::AbstractElement abstract_element, MatchingRuleSet const& matching_rule_set) const
+{
+    // Besides the matched rules, the cascade only looks at the element for its inline style and presentational hints,
+    // and at the parent for inherited custom properties and the writing mode used to map logical properties.
+    auto const& element = abstract_element.element();
+    if (element.inline_style() || element.is_svg_element() || has_presentational_hint_attributes(element))
+        return {};
+
+    auto parent = abstract_element.element_to_inherit_style_from();
+    if (!parent.has_value() || !parent->computed_properties())
+        return {};
+
+    MatchedPropertiesCacheKey key;
+    key.parent_style = parent->computed_properties();
+
+    auto hash = ptr_hash(key.parent_style.ptr());
+    auto append_rules = [&](Vector<MatchingRule const*> const& rules) {
+        for (auto const* rule : rules) {
+            key.matching_rules.append(rule);
+            hash = pair_int_hash(hash, ptr_hash(rule));
+        }
+        key.matching_rules.append(nullptr);
+        hash = pair_int_hash(hash, 0);
+    };
+    append_rules(matching_rule_set.user_agent_rules);
+    append_rules(matching_rule_set.user_rules);
+    for (auto const& layer : matching_rule_set.author_rules)
+        append_rules(layer.rules);
+    key.hash = hash;
+
+    return key;
+}
+
+GC::Ptr<ComputedProperties> StyleComputer::share_style_with_previous_sibling_if_possible(DOM::Element& element, Optional<bool&> did_change_custom_properties) const
+{
+    static constexpr size_t max_siblings_to_consider = 8;
+
+    if (is_in_user_action_state(element) || element.assigned_slot_internal()) {
+        ++m_style_sharing_statistics.misses;
+        return {};
+    }
+
+    // Siblings share the parent, so the inherited values and the ancestors seen by selector matching (and the
+    // ancestor filter) are the same. What's left is the element itself, which we compare by tag and attributes.
+    size_t siblings_considered = 0;
+    for (auto* sibling = element.previous_element_sibling(); sibling && siblings_considered < max_siblings_to_consider; sibling = sibling->previous_element_sibling(), ++siblings_considered) {
+        if (!m_style_sharing_candidates.contains(*sibling))
+            continue;
+        if (sibling->local_name() != element.local_name() || sibling->namespace_uri() != element.namespace_uri())
+            continue;
+        if (!have_same_attributes(*sibling, element) || is_in_user_action_state(*sibling))
+            continue;
+        auto sibling_style = sibling->computed_properties();
+        if (!sibling_style || sibling->needs_style_update())
+            continue;
+
+        ++m_style_sharing_statistics.hits;
+
+        DOM::AbstractElement abstract_element { element };
+        auto old_custom_properties = abstract_element.custom_properties();
+        abstract_element.set_custom_properties(OrderedHashMap<FlyString, StyleProperty> { DOM::AbstractElement { *sibling }.custom_properties() });
+        abstract_element.set_cascaded_properties(DOM::AbstractElement { *sibling }.cascaded_properties());
+        if (sibling->style_uses_attr_css_function())
+            element.set_style_uses_attr_css_function();
+        if (sibling->style_uses_var_css_function())
+            element.set_style_uses_var_css_function();
+
+        if (did_change_custom_properties.has_value() && abstract_element.custom_properties() != old_custom_properties)
+            *did_change_custom_properties = true;
+
+        // Keep the run going for the siblings after this one.
+        m_style_sharing_candidates.set(element);
+
+        // The style gets its own copy, as animations mutate the computed properties of their target in place.
+        return sibling_style->clone();
+    }
+
+    ++m_style_sharing_statistics.misses;
+    return {};
+}
+
 static bool is_monospace(StyleValue const& value)
 {
     if (!value.is_value_list())
@@ -2843,6 +3063,13 @@ void StyleComputer::reset_ancestor_filter()
     m_ancestor_filter->clear();
 }
 
+void StyleComputer::set_style_sharing_enabled(Badge<DOM::Document>, bool enabled)
+{
+    m_style_sharing_enabled = enabled;
+    m_style_sharing_candidates.clear();
+    m_matched_properties_cache.clear();
+}
+
 void StyleComputer::reset_has_result_cache()
 {
     if (!m_has_result_cache)
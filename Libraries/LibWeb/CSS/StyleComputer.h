@@ -8,6 +8,7 @@
 #pragma once
 
 #include <AK/HashMap.h>
+#include <AK/HashTable.h>
 #include <AK/Optional.h>
 #include <AK/OwnPtr.h>
 #include <LibWeb/Animations/KeyframeEffect.h>
@@ -19,6 +20,7 @@
 #include <LibWeb/CSS/Selector.h>
 #include <LibWeb/CSS/SelectorEngine.h>
 #include <LibWeb/CSS/StyleInvalidationData.h>
+#include <LibWeb/CSS/StyleProperty.h>
 #include <LibWeb/CSS/StyleScope.h>
 #include <LibWeb/Export.h>
 #include <LibWeb/Forward.h>
@@ -100,6 +102,18 @@ public:
     void push_ancestor(DOM::Element const&);
     void pop_ancestor(DOM::Element const&);
 
+    // While enabled, elements can reuse the computed style of a previous sibling that matched the same rules, skipping
+    // selector matching and the cascade, and elements that matched the same rules as an earlier element with the same
+    // parent style reuse its cascaded values. This is only sound while the DOM doesn't change, i.e. during a style update.
+    void set_style_sharing_enabled(Badge<DOM::Document>, bool);
+
+    struct CacheStatistics {
+        size_t hits { 0 };
+        size_t misses { 0 };
+    };
+    CacheStatistics const& style_sharing_statistics() const { return m_style_sharing_statistics; }
+    CacheStatistics const& matched_properties_cache_statistics() const { return m_matched_properties_cache_statistics; }
+
     [[nodiscard]] GC::Ref<ComputedProperties> create_document_style() const;
 
     [[nodiscard]] GC::Ref<ComputedProperties> compute_style(DOM::AbstractElement, Optional<bool&> did_change_custom_properties = {}) const;
@@ -165,6 +179,25 @@ private:
 
     LogicalAliasMappingContext compute_logical_alias_mapping_context(DOM::AbstractElement, ComputeStyleMode, MatchingRuleSet const&) const;
     [[nodiscard]] GC::Ptr<ComputedProperties> compute_style_impl(DOM::AbstractElement, ComputeStyleMode, Optional<bool&> did_change_custom_properties, StyleScope const&) const;
+    [[nodiscard]] GC::Ptr<ComputedProperties> share_style_with_previous_sibling_if_possible(DOM::Element&, Optional<bool&> did_change_custom_properties) const;
+
+    struct MatchedPropertiesCacheKey {
+        GC::Ptr<ComputedProperties const> parent_style;
+        // The matched rules of each origin and layer in cascade order, each group terminated by nullptr.
+        Vector<MatchingRule const*> matching_rules;
+        unsigned hash { 0 };
+
+        bool operator==(MatchedPropertiesCacheKey const&) const = default;
+    };
+    struct MatchedPropertiesCacheKeyTraits : public DefaultTraits<MatchedPropertiesCacheKey> {
+        static unsigned hash(MatchedPropertiesCacheKey const& key) { return key.hash; }
+    };
+    struct MatchedPropertiesCacheEntry {
+        GC::Ref<CascadedProperties> cascaded_properties;
+        OrderedHashMap<FlyString, StyleProperty> custom_properties;
+        bool uses_var_css_function { false };
+    };
+    [[nodiscard]] Optional<MatchedPropertiesCacheKey> matched_properties_cache_key(DOM::AbstractElement, MatchingRuleSet const&) const;
     [[nodiscard]] GC::Ref<CascadedProperties> compute_cascaded_values(DOM::AbstractElement, bool did_match_any_pseudo_element_rules, ComputeStyleMode, MatchingRuleSet const&, Optional<LogicalAliasMappingContext>, ReadonlySpan<PropertyID> properties_to_cascade) const;
     void compute_custom_properties(ComputedProperties&, DOM::AbstractElement) const;
     void compute_math_depth(ComputedProperties&, Optional<DOM::AbstractElement>) const;
@@ -197,6 +230,14 @@ private:
 
     OwnPtr<CountingBloomFilter<u8, 14>> m_ancestor_filter;
     OwnPtr<SelectorEngine::HasResultCache> m_has_result_cache;
+
+    bool m_style_sharing_enabled { false };
+    mutable HashTable<GC::Ref<DOM::Element const>> m_style_sharing_candidates;
+    mutable CacheStatistics m_style_sharing_statistics;
+
+    static constexpr size_t max_matched_properties_cache_size = 4096;
+    mutable HashMap<MatchedPropertiesCacheKey, MatchedPropertiesCacheEntry, MatchedPropertiesCacheKeyTraits> m_matched_properties_cache;
+    mutable CacheStatistics m_matched_properties_cache_statistics;
 };
 
 inline bool StyleComputer::should_reject_with_ancestor_filter(Selector const& selector) const
@@ -483,21 +483,11 @@ Document::Document(JS::Realm& realm, URL::URL const& url, TemporaryDocumentForFr
     };
 
     m_cursor_blink_timer = Core::Timer::create_repeating(500, [this] {
-        auto cursor_position = this->cursor_position();
-        if (!cursor_position)
-            return;
-
         auto navigable = this->navigable();
         if (!navigable || !navigable->is_focused())
             return;
 
-        auto node = cursor_position->node();
-        node->document().update_layout(UpdateLayoutReason::CursorBlinkTimer);
-
-        if (node->paintable()) {
-            m_cursor_blink_state = !m_cursor_blink_state;
-            node->paintable()->set_needs_display();
-        }
+        blink_cursor();
     });
 
     HTML::main_thread_event_loop().register_document({}, *this);
@@ -1362,6 +1352,44 @@ static void propagate_overflow_to_viewport(Element& root_element, Layout::Viewpo
     overflow_origin_computed_values.set_overflow_y(CSS::Overflow::Visible);
 }
 
+void Document::update_containing_blocks_and_contained_abspos_children()
+{
+    // NOTE: We also number the layout nodes in tree order here, since this walk reruns whenever the tree has changed.
+    u32 next_layout_index = 0;
+    m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
+        layout_node.set_layout_index({}, next_layout_index++);
+        layout_node.recompute_containing_block({});
+        return TraversalDecision::Continue;
+    });
+
+    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
+        child.clear_contained_abspos_children();
+        return TraversalDecision::Continue;
+    });
+
+    // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
+    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
+        if (!child.is_absolutely_positioned())
+            return TraversalDecision::Continue;
+        if (auto containing_block = child.containing_block()) {
+            auto closest_box_that_establishes_formatting_context = containing_block;
+            while (closest_box_that_establishes_formatting_context) {
+                if (closest_box_that_establishes_formatting_context == m_layout_root)
+                    break;
+                if (Layout::FormattingContext::formatting_context_type_created_by_box(*closest_box_that_establishes_formatting_context).has_value()) {
+                    break;
+                }
+                closest_box_that_establishes_formatting_context = closest_box_that_establishes_formatting_context->containing_block();
+            }
+            VERIFY(closest_box_that_establishes_formatting_context);
+            closest_box_that_establishes_formatting_context->add_contained_abspos_child(child);
+        }
+        return TraversalDecision::Continue;
+    });
+
+    m_needs_containing_block_update = false;
+}
+
 void Document::update_layout(UpdateLayoutReason reason)
 {
     auto navigable = this->navigable();
@@ -1391,6 +1419,7 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (!m_layout_root || needs_layout_tree_update() || child_needs_layout_tree_update() || needs_full_layout_tree_update()) {
         Layout::TreeBuilder tree_builder;
         m_layout_root = as<Layout::Viewport>(*tree_builder.build(*this));
+        m_needs_containing_block_update = true;
 
         if (document_element && document_element->layout_node()) {
             propagate_overflow_to_viewport(*document_element, *m_layout_root);
@@ -1399,40 +1428,22 @@ void Document::update_layout(UpdateLayoutReason reason)
 
         set_needs_full_layout_tree_update(false);
 
+        auto build_duration = timer.elapsed_time();
+        ++m_layout_tree_build_statistics.build_count;
+        m_layout_tree_build_statistics.last_rebuilt_subtree_count = tree_builder.rebuilt_subtree_count();
+        m_layout_tree_build_statistics.last_build_duration = build_duration;
+        m_layout_tree_build_statistics.total_build_duration += build_duration;
+
         if constexpr (UPDATE_LAYOUT_DEBUG) {
-            dbgln("TREEBUILD {} µs", timer.elapsed_time().to_microseconds());
+            dbgln("TREEBUILD {} µs ({} subtrees)", build_duration.to_microseconds(), tree_builder.rebuilt_subtree_count());
         }
     }
 
-    m_layout_root->for_each_in_inclusive_subtree([&](auto& layout_node) {
-        layout_node.recompute_containing_block({});
-        return TraversalDecision::Continue;
-    });
-
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        child.clear_contained_abspos_children();
-        return TraversalDecision::Continue;
-    });
-
-    // Assign each box that establishes a formatting context a list of absolutely positioned children it should take care of during layout
-    m_layout_root->for_each_in_inclusive_subtree_of_type<Layout::Box>([&](auto& child) {
-        if (!child.is_absolutely_positioned())
-            return TraversalDecision::Continue;
-        if (auto containing_block = child.containing_block()) {
-            auto closest_box_that_establishes_formatting_context = containing_block;
-            while (closest_box_that_establishes_formatting_context) {
-                if (closest_box_that_establishes_formatting_context == m_layout_root)
-                    break;
-                if (Layout::FormattingContext::formatting_context_type_created_by_box(*closest_box_that_establishes_formatting_context).has_value()) {
-                    break;
-                }
-                closest_box_that_establishes_formatting_context = closest_box_that_establishes_formatting_context->containing_block();
-            }
-            VERIFY(closest_box_that_establishes_formatting_context);
-            closest_box_that_establishes_formatting_context->add_contained_abspos_child(child);
-        }
-        return TraversalDecision::Continue;
-    });
+    // OPTIMIZATION: Containing blocks and abspos lists only depend on the shape of the layout tree and the style of its
+    //               nodes. When neither has changed, e.g. when the viewport is resized or text is edited, we don't
+    //               have to walk the whole tree to recompute them.
+    if (m_needs_containing_block_update)
+        update_containing_blocks_and_contained_abspos_children();
 
     Layout::LayoutState layout_state;
 
@@ -1514,9 +1525,11 @@ void Document::update_layout(UpdateLayoutReason reason)
     bool is_display_none = false;
 
     bool did_change_custom_properties = false;
+    bool is_styled_for_the_first_time = false;
     CSS::RequiredInvalidationAfterStyleChange node_invalidation;
     if (is<Element>(node)) {
         auto& element = static_cast<Element&>(node);
+        is_styled_for_the_first_time = !element.computed_properties();
         if (needs_full_style_update || node.needs_style_update() || (recompute_elements_depending_on_custom_properties && element.style_uses_var_css_function())) {
             node_invalidation = element.recompute_style(did_change_custom_properties);
         } else if (needs_inherited_style_update) {
@@ -1530,7 +1543,11 @@ void Document::update_layout(UpdateLayoutReason reason)
     if (node_invalidation.rebuild_layout_tree) {
         // We mark layout tree for rebuild starting from parent element to correctly invalidate
         // "display" property change to/from "contents" value.
-        if (auto parent_element = node.parent_element()) {
+        // An element that is styled for the first time has no "display" value to change from, so it's enough to build
+        // a layout tree for it and leave it to the layout tree builder to splice it into its parent's.
+        if (is_styled_for_the_first_time) {
+            node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
+        } else if (auto parent_element = node.parent_element()) {
             parent_element->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
         } else {
             node.set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::StyleChange);
@@ -1611,7 +1628,9 @@ void Document::update_style()
     style_computer().reset_has_result_cache();
     style_computer().reset_ancestor_filter();
 
+    style_computer().set_style_sharing_enabled({}, true);
     auto invalidation = update_style_recursively(*this, style_computer(), false, false);
+    style_computer().set_style_sharing_enabled({}, false);
     if (!invalidation.is_none())
         invalidate_display_list();
     if (invalidation.rebuild_stacking_context_tree)
@@ -1771,14 +1790,11 @@ void Document::set_highlighted_node(GC::Ptr<Node> node, Optional<CSS::PseudoElem
     if (m_highlighted_node == node && m_highlighted_pseudo_element == pseudo_element)
         return;
 
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
-
     m_highlighted_node = node;
     m_highlighted_pseudo_element = pseudo_element;
 
-    if (auto layout_node = highlighted_layout_node(); layout_node && layout_node->first_paintable())
-        layout_node->first_paintable()->set_needs_display();
+    // NOTE: The highlight overlay also paints a label outside of the node, so we repaint the whole viewport.
+    set_needs_display();
 }
 
 GC::Ptr<Layout::Node> Document::highlighted_layout_node()
@@ -6481,6 +6497,21 @@ GC::Ptr<DOM::Position> Document::cursor_position() const
     return nullptr;
 }
 
+void Document::blink_cursor()
+{
+    auto cursor_position = this->cursor_position();
+    if (!cursor_position)
+        return;
+
+    auto node = cursor_position->node();
+    node->document().update_layout(UpdateLayoutReason::CursorBlinkTimer);
+
+    if (node->paintable()) {
+        m_cursor_blink_state = !m_cursor_blink_state;
+        node->paintable()->set_needs_display();
+    }
+}
+
 void Document::reset_cursor_blink_cycle()
 {
     m_cursor_blink_state = true;
@@ -6511,10 +6542,11 @@ void Document::set_cached_navigable(GC::Ptr<HTML::Navigable> navigable)
 
 void Document::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
+    m_needs_full_repaint = true;
     set_needs_display(viewport_rect(), should_invalidate_display_list);
 }
 
-void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList should_invalidate_display_list)
+void Document::set_needs_display(CSSPixelRect const& rect, InvalidateDisplayList should_invalidate_display_list)
 {
     // FIXME: Ignore updates outside the visible viewport rect.
     //        This requires accounting for fixed-position elements in the input rect, which we don't do yet.
@@ -6525,8 +6557,21 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
             return;
     }
 
-    if (should_invalidate_display_list == InvalidateDisplayList::Yes) {
-        invalidate_display_list();
+    // NOTE: We don't go through invalidate_display_list() here, since that would damage the whole viewport.
+    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+        m_cached_display_list.clear();
+
+    if (!m_needs_full_repaint) {
+        // Past a handful of rects, replaying the display list once per rect costs more than repainting their union.
+        static constexpr size_t max_damage_rect_count = 8;
+        if (m_damage_rects.size() < max_damage_rect_count) {
+            m_damage_rects.append(rect);
+        } else {
+            for (auto const& damage_rect : m_damage_rects.span().slice(1))
+                m_damage_rects.first().unite(damage_rect);
+            m_damage_rects.resize(1);
+            m_damage_rects.first().unite(rect);
+        }
     }
 
     auto navigable = this->navigable();
@@ -6539,14 +6584,25 @@ void Document::set_needs_display(CSSPixelRect const&, InvalidateDisplayList shou
         return;
     }
 
+    // FIXME: Map the rect into the container document instead of damaging its whole viewport.
     if (auto container = navigable->container()) {
         container->document().set_needs_display(should_invalidate_display_list);
     }
 }
 
+Optional<Vector<CSSPixelRect>> Document::take_damage_rects()
+{
+    auto damage_rects = move(m_damage_rects);
+    m_damage_rects.clear();
+    if (exchange(m_needs_full_repaint, false))
+        return {};
+    return damage_rects;
+}
+
 void Document::invalidate_display_list()
 {
     m_cached_display_list.clear();
+    m_needs_full_repaint = true;
 
     auto navigable = this->navigable();
     if (!navigable)
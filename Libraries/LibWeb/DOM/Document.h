@@ -13,6 +13,7 @@
 #include <AK/HashMap.h>
 #include <AK/OwnPtr.h>
 #include <AK/String.h>
+#include <AK/Time.h>
 #include <AK/Vector.h>
 #include <AK/WeakPtr.h>
 #include <LibCore/Forward.h>
@@ -612,6 +613,18 @@ public:
     [[nodiscard]] bool needs_full_layout_tree_update() const { return m_needs_full_layout_tree_update; }
     void set_needs_full_layout_tree_update(bool b) { m_needs_full_layout_tree_update = b; }
 
+    // Must be called whenever something that the containing blocks of layout nodes, or the lists of abspos children
+    // that boxes lay out, could depend on has changed.
+    void set_needs_containing_block_update() { m_needs_containing_block_update = true; }
+
+    struct LayoutTreeBuildStatistics {
+        size_t build_count { 0 };
+        size_t last_rebuilt_subtree_count { 0 };
+        AK::Duration last_build_duration;
+        AK::Duration total_build_duration;
+    };
+    LayoutTreeBuildStatistics const& layout_tree_build_statistics() const { return m_layout_tree_build_statistics; }
+
     void set_needs_to_refresh_scroll_state(bool b);
 
     bool has_active_favicon() const { return m_active_favicon; }
@@ -863,9 +876,15 @@ public:
     GC::Ptr<HTML::Navigable> cached_navigable();
     void set_cached_navigable(GC::Ptr<HTML::Navigable>);
 
+    // Without a rect, the whole viewport is repainted. A rect is in document coordinates and must cover everything that
+    // was painted differently, since only the damaged parts of the viewport may get repainted in the next frame.
     void set_needs_display(InvalidateDisplayList = InvalidateDisplayList::Yes);
     void set_needs_display(CSSPixelRect const&, InvalidateDisplayList = InvalidateDisplayList::Yes);
 
+    // Returns the rects (in document coordinates) that were damaged since the last call, or nothing if the whole
+    // viewport has to be repainted.
+    Optional<Vector<CSSPixelRect>> take_damage_rects();
+
     RefPtr<Painting::DisplayList> cached_display_list() const;
     RefPtr<Painting::DisplayList> record_display_list(HTML::PaintConfig);
 
@@ -903,6 +922,7 @@ public:
     void set_show_view_transition_tree(bool value) { m_show_view_transition_tree = value; }
     Vector<GC::Ptr<ViewTransition::ViewTransition>>& update_callback_queue() { return m_update_callback_queue; }
 
+    void blink_cursor();
     void reset_cursor_blink_cycle();
 
     GC::Ref<EditingHostManager> editing_host_manager() const { return *m_editing_host_manager; }
@@ -985,6 +1005,8 @@ private:
 
     void tear_down_layout_tree();
 
+    void update_containing_blocks_and_contained_abspos_children();
+
     void update_active_element();
 
     void run_unloading_cleanup_steps();
@@ -1150,6 +1172,8 @@ private:
 
     bool m_needs_full_style_update { false };
     bool m_needs_full_layout_tree_update { false };
+    LayoutTreeBuildStatistics m_layout_tree_build_statistics;
+    bool m_needs_containing_block_update { true };
 
     bool m_needs_animated_style_update { false };
 
@@ -1317,6 +1341,9 @@ private:
     Optional<HTML::PaintConfig> m_cached_display_list_paint_config;
     RefPtr<Painting::DisplayList> m_cached_display_list;
 
+    Vector<CSSPixelRect> m_damage_rects;
+    bool m_needs_full_repaint { true };
+
     mutable OwnPtr<Unicode::Segmenter> m_grapheme_segmenter;
     mutable OwnPtr<Unicode::Segmenter> m_word_segmenter;
 
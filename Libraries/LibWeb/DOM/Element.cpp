@@ -744,12 +744,21 @@ CSS::RequiredInvalidationAfterStyleChange Element::recompute_style(bool& did_cha
         invalidation = CSS::RequiredInvalidationAfterStyleChange::full();
     }
 
-    auto old_display_is_none = m_computed_properties ? m_computed_properties->display().is_none() : true;
+    // OPTIMIZATION: An element that is styled for the first time can't have changed its display from none. Unstyled
+    //               elements don't count as display:none ancestors when animations are played or canceled on
+    //               insertion, so walking the subtree here would not change anything. Skipping it avoids visiting
+    //               every descendant of every element in a freshly inserted subtree, which is quadratic in its depth.
+    //               The element's own CSS animations were only just created though, so they still need to be canceled
+    //               if it ended up inside a display:none subtree.
+    auto had_computed_properties = m_computed_properties != nullptr;
+    auto old_display_is_none = had_computed_properties && m_computed_properties->display().is_none();
     auto new_display_is_none = new_computed_properties->display().is_none();
 
     set_computed_properties({}, move(new_computed_properties));
 
-    if (old_display_is_none != new_display_is_none) {
+    if (!had_computed_properties) {
+        play_or_cancel_animations_after_display_property_change();
+    } else if (old_display_is_none != new_display_is_none) {
         for_each_shadow_including_inclusive_descendant([&](auto& node) {
             if (!node.is_element())
                 return TraversalDecision::Continue;
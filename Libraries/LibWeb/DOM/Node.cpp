@@ -667,6 +667,42 @@ WebIDL::ExceptionOr<void> Node::ensure_pre_insertion_validity(JS::Realm& realm,
 }
 
 // https://dom.spec.whatwg.org/#concept-node-insert
+// Building layout trees for nodes appended to a parent, and appending them to the parent's existing layout node, must give
+// the same result as rebuilding the parent's layout tree. That's the case when the parent's layout node is a block
+// container that's in the layout tree, and doesn't generate any boxes after its children.
+static bool can_append_layout_subtrees_for_inserted_nodes(Node& parent, Vector<GC::Root<Node>> const& nodes)
+{
+    auto* element = as_if<Element>(parent);
+    if (!element || element->needs_layout_tree_update())
+        return false;
+
+    auto layout_node = element->layout_node();
+    if (!layout_node || !layout_node->parent())
+        return false;
+
+    // Inline boxes may have been split into continuations, so the last box of the element isn't necessarily this one.
+    auto display = layout_node->display();
+    if (!(display.is_flow_inside() || display.is_flow_root_inside()) || (display.is_inline_outside() && display.is_flow_inside()))
+        return false;
+
+    // Shadow hosts, slots and SVG elements lay out their children from elsewhere, and button layout wraps them.
+    if (element->shadow_root() || is<HTML::HTMLSlotElement>(*element) || is<SVG::SVGElement>(*element))
+        return false;
+    if (auto* html_element = as_if<HTML::HTMLElement>(*element); html_element && html_element->uses_button_layout())
+        return false;
+
+    if (element->get_pseudo_element_node(CSS::PseudoElement::After))
+        return false;
+
+    // A node that was moved here keeps the layout node from its previous parent until it's rebuilt.
+    for (auto& node : nodes) {
+        if (node->layout_node())
+            return false;
+    }
+
+    return true;
+}
+
 void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_observers)
 {
     // 1. Let nodes be node’s children, if node is a DocumentFragment node; otherwise « node ».
@@ -816,7 +852,22 @@ void Node::insert_before(GC::Ref<Node> node, GC::Ptr<Node> child, bool suppress_
         if (layout_node() && layout_node()->display().is_contents() && parent_element()) {
             parent_element()->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBeforeWithDisplayContents);
         }
-        set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+
+        if (!child && can_append_layout_subtrees_for_inserted_nodes(*this, nodes)) {
+            // OPTIMIZATION: Only build layout trees for the appended nodes, and let the layout tree builder append them
+            //               to our existing layout node. This keeps e.g. infinite scrolling lists from rebuilding the
+            //               layout tree of every item whenever a new one is added.
+            for (auto& node : nodes)
+                node->set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+
+            // A node may already have been flagged while it was disconnected, so make sure that its new ancestors know.
+            for (auto* ancestor = this; ancestor && !ancestor->m_child_needs_layout_tree_update; ancestor = ancestor->parent_or_shadow_host())
+                ancestor->m_child_needs_layout_tree_update = true;
+
+            layout_node()->set_needs_layout_update(SetNeedsLayoutReason::LayoutTreeUpdate);
+        } else {
+            set_needs_layout_tree_update(true, SetNeedsLayoutTreeUpdateReason::NodeInsertBefore);
+        }
     }
 
     // AD-HOC: invalidate the ordinal of the first list_item of the list_owner of the child node, if any.
@@ -224,6 +224,11 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // OPTIMIZATION: Use the idle period to get ahead of the allocation-triggered garbage collection, so that its
+        //               pause is less likely to land in the middle of a script or a rendering update.
+        auto idle_time_remaining = compute_deadline() - HighResolutionTime::unsafe_shared_current_time();
+        heap().collect_garbage_during_idle_time(AK::Duration::from_microseconds(static_cast<i64>(idle_time_remaining * 1000)));
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
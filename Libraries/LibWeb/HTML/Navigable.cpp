@@ -2738,35 +2738,67 @@ void Navigable::paint_next_frame()
     if (!is_top_level_traversable())
         return;
 
-    auto [backing_store_id, painting_surface] = m_backing_store_manager->acquire_store_for_next_frame();
+    auto [backing_store_id, painting_surface, previous_frame_store] = m_backing_store_manager->acquire_store_for_next_frame();
     if (!painting_surface)
         return;
 
     VERIFY(m_number_of_queued_rasterization_tasks <= 1);
     m_number_of_queued_rasterization_tasks++;
 
-    auto viewport_rect = page().css_to_device_rect(this->viewport_rect()).to_type<int>();
+    auto device_viewport_rect = page().css_to_device_rect(this->viewport_rect());
+    auto viewport_rect = device_viewport_rect.to_type<int>();
     PaintConfig paint_config { .paint_overlay = true, .should_show_line_box_borders = m_should_show_line_box_borders, .canvas_fill_rect = Gfx::IntRect { {}, viewport_rect.size() } };
+
+    // If the page only changed in a few places since the last frame, we only repaint those and copy everything else
+    // from the store that holds the last frame.
+    Optional<Painting::PartialRepaint> partial_repaint;
+    if (auto document = active_document()) {
+        auto damage_rects = document->take_damage_rects();
+        auto visual_viewport = document->visual_viewport();
+        if (previous_frame_store
+            && damage_rects.has_value()
+            && m_last_painted_viewport_rect == device_viewport_rect
+            && m_last_paint_config == paint_config
+            && visual_viewport->scale() == 1
+            && visual_viewport->offset().is_zero()) {
+            Gfx::IntRect surface_rect { {}, viewport_rect.size() };
+            auto scroll_offset = this->viewport_rect().location();
+            Vector<Gfx::IntRect> device_damage_rects;
+            for (auto damage_rect : *damage_rects) {
+                damage_rect.translate_by(-scroll_offset);
+                // NOTE: We inflate the rect a little to cover anti-aliasing that bleeds over the edges of what changed.
+                auto device_damage_rect = page().enclosing_device_rect(damage_rect).to_type<int>().inflated(2, 2).intersected(surface_rect);
+                if (!device_damage_rect.is_empty())
+                    device_damage_rects.append(device_damage_rect);
+            }
+            partial_repaint = Painting::PartialRepaint { previous_frame_store.release_nonnull(), move(device_damage_rects) };
+        }
+    }
+    m_last_painted_viewport_rect = device_viewport_rect;
+    m_last_paint_config = paint_config;
+
     auto page_client = &page().top_level_traversable()->page().client();
-    start_display_list_rendering(*painting_surface, paint_config, [page_client, viewport_rect, backing_store_id] {
+    auto did_paint = [page_client, viewport_rect, backing_store_id] {
         if (!page_client)
             return;
         page_client->page_did_paint(viewport_rect, backing_store_id);
-    });
+    };
+    if (!start_display_list_rendering(*painting_surface, paint_config, move(did_paint), move(partial_repaint)))
+        m_backing_store_manager->did_not_paint_acquired_store();
 }
 
-void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback)
+bool Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surface, PaintConfig paint_config, Function<void()>&& callback, Optional<Painting::PartialRepaint>&& partial_repaint)
 {
     m_needs_repaint = false;
     auto document = active_document();
     if (!document) {
         callback();
-        return;
+        return false;
     }
     auto display_list = document->record_display_list(paint_config);
     if (!display_list) {
         callback();
-        return;
+        return false;
     }
 
     auto& document_paintable = *document->paintable();
@@ -2791,7 +2823,8 @@ void Navigable::start_display_list_rendering(Gfx::PaintingSurface& painting_surf
         return TraversalDecision::Continue;
     });
 
-    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(callback));
+    m_rendering_thread.enqueue_rendering_task(*display_list, move(scroll_state_snapshot_by_display_list), painting_surface, move(partial_repaint), move(callback));
+    return true;
 }
 
 RefPtr<Gfx::SkiaBackendContext> Navigable::skia_backend_context() const
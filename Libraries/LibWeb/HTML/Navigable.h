@@ -200,7 +200,7 @@ public:
     bool is_ready_to_paint() const;
     void ready_to_paint();
     void paint_next_frame();
-    void start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback);
+    bool start_display_list_rendering(Gfx::PaintingSurface&, PaintConfig, Function<void()>&& callback, Optional<Painting::PartialRepaint>&& = {});
 
     bool needs_repaint() const { return m_needs_repaint; }
     void set_needs_repaint() { m_needs_repaint = true; }
@@ -283,6 +283,8 @@ private:
     bool m_pending_set_browser_zoom_request { false };
     bool m_should_show_line_box_borders { false };
     i32 m_number_of_queued_rasterization_tasks { 0 };
+    Optional<DevicePixelRect> m_last_painted_viewport_rect;
+    Optional<PaintConfig> m_last_paint_config;
     GC::Ref<Painting::BackingStoreManager> m_backing_store_manager;
     RefPtr<Gfx::SkiaBackendContext> m_skia_backend_context;
     RenderingThread m_rendering_thread;
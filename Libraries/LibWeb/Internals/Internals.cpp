@@ -7,6 +7,8 @@
 
 #include <AK/JsonObject.h>
 #include <LibGfx/Cursor.h>
+#include <LibGfx/Font/Font.h>
+#include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibUnicode/TimeZone.h>
@@ -15,6 +17,7 @@
 #include <LibWeb/Bindings/InternalsPrototype.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
+#include <LibWeb/CSS/StyleComputer.h>
 #include <LibWeb/DOM/Document.h>
 #include <LibWeb/DOM/Event.h>
 #include <LibWeb/DOM/EventTarget.h>
@@ -371,6 +374,81 @@ String Internals::dump_gc_graph()
     return Bindings::main_thread_vm().heap().dump_graph().serialized();
 }
 
+JS::Object* Internals::gc_statistics()
+{
+    auto const& statistics = vm().heap().statistics();
+
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("collectionCount"_utf16_fly_string, JS::Value(statistics.collection_count), JS::default_attributes);
+    result->define_direct_property("idleCollectionCount"_utf16_fly_string, JS::Value(statistics.idle_collection_count), JS::default_attributes);
+    result->define_direct_property("lastMarkTime"_utf16_fly_string, JS::Value(statistics.last_mark_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    result->define_direct_property("totalMarkTime"_utf16_fly_string, JS::Value(statistics.total_mark_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    result->define_direct_property("lastCollectionTime"_utf16_fly_string, JS::Value(statistics.last_collection_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    result->define_direct_property("totalCollectionTime"_utf16_fly_string, JS::Value(statistics.total_collection_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::style_statistics()
+{
+    auto const& style_computer = window().associated_document().style_computer();
+    auto const& style_sharing_statistics = style_computer.style_sharing_statistics();
+    auto const& matched_properties_cache_statistics = style_computer.matched_properties_cache_statistics();
+
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("styleSharingHits"_utf16_fly_string, JS::Value(style_sharing_statistics.hits), JS::default_attributes);
+    result->define_direct_property("styleSharingMisses"_utf16_fly_string, JS::Value(style_sharing_statistics.misses), JS::default_attributes);
+    result->define_direct_property("matchedPropertiesCacheHits"_utf16_fly_string, JS::Value(matched_properties_cache_statistics.hits), JS::default_attributes);
+    result->define_direct_property("matchedPropertiesCacheMisses"_utf16_fly_string, JS::Value(matched_properties_cache_statistics.misses), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::layout_tree_build_statistics()
+{
+    auto const& statistics = window().associated_document().layout_tree_build_statistics();
+
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("buildCount"_utf16_fly_string, JS::Value(statistics.build_count), JS::default_attributes);
+    result->define_direct_property("lastRebuiltSubtreeCount"_utf16_fly_string, JS::Value(statistics.last_rebuilt_subtree_count), JS::default_attributes);
+    result->define_direct_property("lastBuildTime"_utf16_fly_string, JS::Value(statistics.last_build_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    result->define_direct_property("totalBuildTime"_utf16_fly_string, JS::Value(statistics.total_build_duration.to_microseconds() / 1000.0), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::text_shaping_cache_statistics()
+{
+    auto const& statistics = Gfx::Font::ShapingCache::statistics();
+
+    auto result = JS::Object::create(realm(), nullptr);
+    result->define_direct_property("hitCount"_utf16_fly_string, JS::Value(statistics.hit_count), JS::default_attributes);
+    result->define_direct_property("missCount"_utf16_fly_string, JS::Value(statistics.miss_count), JS::default_attributes);
+    result->define_direct_property("evictionCount"_utf16_fly_string, JS::Value(statistics.eviction_count), JS::default_attributes);
+    result->define_direct_property("entryCount"_utf16_fly_string, JS::Value(statistics.entry_count), JS::default_attributes);
+    result->define_direct_property("byteCount"_utf16_fly_string, JS::Value(statistics.byte_count), JS::default_attributes);
+    result->define_direct_property("byteBudget"_utf16_fly_string, JS::Value(Gfx::Font::ShapingCache::byte_budget()), JS::default_attributes);
+    return result;
+}
+
+JS::Object* Internals::take_damage_rects()
+{
+    auto damage_rects = window().associated_document().take_damage_rects();
+    if (!damage_rects.has_value())
+        return nullptr;
+
+    return JS::Array::create_from<CSSPixelRect>(realm(), damage_rects->span(), [&](CSSPixelRect const& damage_rect) -> JS::Value {
+        auto result = JS::Object::create(realm(), nullptr);
+        result->define_direct_property("x"_utf16_fly_string, JS::Value(damage_rect.x().to_double()), JS::default_attributes);
+        result->define_direct_property("y"_utf16_fly_string, JS::Value(damage_rect.y().to_double()), JS::default_attributes);
+        result->define_direct_property("width"_utf16_fly_string, JS::Value(damage_rect.width().to_double()), JS::default_attributes);
+        result->define_direct_property("height"_utf16_fly_string, JS::Value(damage_rect.height().to_double()), JS::default_attributes);
+        return result;
+    });
+}
+
+void Internals::blink_cursor()
+{
+    window().associated_document().blink_cursor();
+}
+
 GC::Ptr<DOM::ShadowRoot> Internals::get_shadow_root(GC::Ref<DOM::Element> element)
 {
     return element->shadow_root();
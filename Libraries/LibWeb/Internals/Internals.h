@@ -73,6 +73,13 @@ public:
 
     String dump_display_list();
     String dump_gc_graph();
+    JS::Object* gc_statistics();
+    JS::Object* style_statistics();
+    JS::Object* layout_tree_build_statistics();
+    JS::Object* text_shaping_cache_statistics();
+
+    JS::Object* take_damage_rects();
+    void blink_cursor();
 
     GC::Ptr<DOM::ShadowRoot> get_shadow_root(GC::Ref<DOM::Element>);
 
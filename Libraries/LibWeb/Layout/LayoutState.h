@@ -6,7 +6,10 @@
 
 #pragma once
 
+#include <AK/Array.h>
 #include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/SegmentedVector.h>
 #include <LibGfx/Path.h>
 #include <LibGfx/Point.h>
 #include <LibWeb/Layout/Box.h>
@@ -196,18 +199,39 @@ struct LayoutState {
         Optional<StaticPositionRect> m_static_position_rect;
     };
 
+    LayoutState() = default;
     ~LayoutState();
 
+    AK_MAKE_NONCOPYABLE(LayoutState);
+    AK_MAKE_NONMOVABLE(LayoutState);
+
     // Commits the used values produced by layout and builds a paintable tree.
     void commit(Box& root);
 
     UsedValues& get_mutable(NodeWithStyle const&);
     UsedValues const& get(NodeWithStyle const&) const;
 
-    OrderedHashMap<GC::Ref<Layout::Node const>, NonnullOwnPtr<UsedValues>> used_values_per_layout_node;
+    // Unlike get(), this returns nullptr instead of creating used values for a node that has none in this state.
+    UsedValues const* try_get(NodeWithStyle const&) const;
 
 private:
     void resolve_relative_positions();
+
+    UsedValues* find_used_values(NodeWithStyle const&) const;
+
+    // Used values are stored in the order they were created in, which is the order commit() visits them in.
+    // Their addresses are stable, since UsedValues point at the used values of their containing block.
+    SegmentedVector<UsedValues, 16> m_used_values;
+
+    // Layout nodes are numbered in tree order before layout (see Node::layout_index()), so we can find their used
+    // values through a paged table. Pages are only allocated once something in their index range is looked up, which
+    // keeps the throwaway states used for intrinsic sizing cheap.
+    static constexpr size_t used_values_page_size = 256;
+    using UsedValuesPage = Array<UsedValues*, used_values_page_size>;
+    Vector<OwnPtr<UsedValuesPage>> m_used_values_pages;
+
+    // Nodes without an index (or with one that is already taken by another node) are looked up here instead.
+    HashMap<GC::Ref<NodeWithStyle const>, UsedValues*> m_used_values_of_unindexed_nodes;
 };
 
 inline CSSPixels clamp_to_max_dimension_value(CSSPixels value)
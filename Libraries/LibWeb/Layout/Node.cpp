@@ -7,6 +7,7 @@
  */
 
 #include <AK/Demangle.h>
+#include <AK/ScopeGuard.h>
 #include <LibWeb/CSS/ComputedProperties.h>
 #include <LibWeb/CSS/StyleValues/AbstractImageStyleValue.h>
 #include <LibWeb/CSS/StyleValues/BorderRadiusStyleValue.h>
@@ -479,8 +480,41 @@ void NodeWithStyle::visit_edges(Visitor& visitor)
         m_list_style_image->as_image().visit_edges(visitor);
 }
 
+// Everything about a node's style that update_containing_blocks_and_contained_abspos_children() depends on, i.e. which
+// ancestor contains it, whether it contains its descendants, and which formatting context takes care of its abspos children.
+struct ContainingBlockRelevantStyle {
+    explicit ContainingBlockRelevantStyle(NodeWithStyle const& node)
+        : position(node.computed_values().position())
+        , display(node.computed_values().display())
+        , float_(node.computed_values().float_())
+        , overflow_x(node.computed_values().overflow_x())
+        , overflow_y(node.computed_values().overflow_y())
+        , establishes_an_absolute_positioning_containing_block(node.establishes_an_absolute_positioning_containing_block())
+        , establishes_a_fixed_positioning_containing_block(node.establishes_a_fixed_positioning_containing_block())
+    {
+    }
+
+    bool operator==(ContainingBlockRelevantStyle const&) const = default;
+
+    CSS::Positioning position;
+    CSS::Display display;
+    CSS::Float float_;
+    CSS::Overflow overflow_x;
+    CSS::Overflow overflow_y;
+    bool establishes_an_absolute_positioning_containing_block;
+    bool establishes_a_fixed_positioning_containing_block;
+};
+
 void NodeWithStyle::apply_style(CSS::ComputedProperties const& computed_style)
 {
+    // NOTE: Animations apply style on every tick, which mostly only changes paint-only properties. Only ask for the
+    //       containing blocks to be recomputed when something they depend on has actually changed.
+    ContainingBlockRelevantStyle const old_containing_block_relevant_style { *this };
+    ScopeGuard update_containing_blocks_if_needed = [&] {
+        if (ContainingBlockRelevantStyle { *this } != old_containing_block_relevant_style)
+            document().set_needs_containing_block_update();
+    };
+
     auto& computed_values = mutable_computed_values();
 
     // NOTE: color-scheme must be set first to ensure system colors can be resolved correctly.
@@ -144,6 +144,11 @@ public:
 
     void recompute_containing_block(Badge<DOM::Document>);
 
+    // Position of this node in a tree order numbering of the layout tree, assigned by the document before layout.
+    // LayoutState uses it to keep per-node used values in dense tables instead of hashing node pointers.
+    Optional<u32> layout_index() const { return m_layout_index; }
+    void set_layout_index(Badge<DOM::Document>, u32 index) { m_layout_index = index; }
+
     [[nodiscard]] Box const* static_position_containing_block() const;
     [[nodiscard]] Box* static_position_containing_block() { return const_cast<Box*>(const_cast<Node const*>(this)->static_position_containing_block()); }
 
@@ -236,6 +241,8 @@ private:
     Optional<CSS::PseudoElement> m_generated_for;
 
     u32 m_initial_quote_nesting_level { 0 };
+
+    Optional<u32> m_layout_index;
 };
 
 class WEB_API NodeWithStyle : public Node {
@@ -668,6 +668,9 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         }
     }
 
+    if (should_create_layout_node && must_create_subtree == MustCreateSubtree::No)
+        m_rebuilt_subtree_roots.append(*layout_node);
+
     auto shadow_root = is<DOM::Element>(dom_node) ? as<DOM::Element>(dom_node).shadow_root() : nullptr;
 
     auto element_has_content_visibility_hidden = [&dom_node]() {
@@ -751,8 +754,11 @@ void TreeBuilder::update_layout_tree(DOM::Node& dom_node, TreeBuilder::Context&
         // that we can maintain the invariant that all children are either inline or non-inline. We can't do this earlier,
         // because the restructuring adds new children after this node that become part of the ancestor stack.
         if (auto node_with_metrics = as_if<NodeWithStyleAndBoxModelMetrics>(*layout_node);
-            node_with_metrics && node_with_metrics->should_create_inline_continuation())
+            node_with_metrics && node_with_metrics->should_create_inline_continuation()) {
             restructure_block_node_in_inline_parent(*node_with_metrics);
+            // The restructuring moves boxes around outside of the subtree we just built.
+            m_needs_table_fixup_of_whole_tree = true;
+        }
     }
 
     // https://www.w3.org/TR/css-contain-2/#containment-style
@@ -878,10 +884,35 @@ GC::Ptr<Layout::Node> TreeBuilder::build(DOM::Node& dom_node)
 
     Context context;
     m_quote_nesting_level = 0;
+    m_rebuilt_subtree_roots.clear();
+    m_needs_table_fixup_of_whole_tree = false;
     update_layout_tree(dom_node, context, MustCreateSubtree::No);
 
-    if (auto* root = dom_node.document().layout_node())
+    auto* root = dom_node.document().layout_node();
+    if (!root)
+        return m_layout_root;
+
+    if (m_needs_table_fixup_of_whole_tree) {
         fixup_tables(*root);
+        return m_layout_root;
+    }
+
+    // OPTIMIZATION: Boxes outside of the rebuilt subtrees have already been fixed up by a previous build, so we only
+    //               fix up the trees around the new boxes. We start at their nearest non-anonymous ancestor, since
+    //               an anonymous wrapper created for a new box might itself be misparented.
+    for (auto& subtree_root : m_rebuilt_subtree_roots) {
+        if (subtree_root.ptr() == root) {
+            fixup_tables(*root);
+            break;
+        }
+        auto* fixup_root = subtree_root->parent();
+        while (fixup_root && fixup_root->is_anonymous())
+            fixup_root = fixup_root->parent();
+        // The subtree may have been removed from the tree again by a later sibling's update.
+        if (!fixup_root || !root->is_inclusive_ancestor_of(*fixup_root))
+            continue;
+        fixup_tables(*fixup_root);
+    }
 
     return m_layout_root;
 }
@@ -20,6 +20,9 @@ public:
 
     GC::Ptr<Layout::Node> build(DOM::Node&);
 
+    // The number of layout subtrees that were created or replaced by the last build.
+    size_t rebuilt_subtree_count() const { return m_rebuilt_subtree_roots.size(); }
+
 private:
     struct Context {
         bool has_svg_root = false;
@@ -64,6 +67,10 @@ private:
     GC::Ptr<Layout::Node> m_layout_root;
     Vector<GC::Ref<Layout::NodeWithStyle>> m_ancestor_stack;
 
+    // The topmost layout nodes created during this build. Only the trees around these need table fixups.
+    Vector<GC::Ref<Layout::Node>> m_rebuilt_subtree_roots;
+    bool m_needs_table_fixup_of_whole_tree { false };
+
     u32 m_quote_nesting_level { 0 };
 };
 
@@ -53,7 +53,10 @@ BackingStoreManager::BackingStore BackingStoreManager::acquire_store_for_next_fr
     BackingStore backing_store;
     backing_store.bitmap_id = m_back_bitmap_id;
     backing_store.store = m_back_store;
+    if (m_front_store_holds_last_frame)
+        backing_store.previous_frame_store = m_front_store;
     swap_back_and_front();
+    m_front_store_holds_last_frame = true;
     return backing_store;
 }
 
@@ -63,6 +66,7 @@ void BackingStoreManager::reallocate_backing_stores(Gfx::IntSize size)
 
     m_front_store = nullptr;
     m_back_store = nullptr;
+    m_front_store_holds_last_frame = false;
 
 #ifdef AK_OS_MACOS
     if (skia_backend_context && s_browser_mach_port.has_value()) {
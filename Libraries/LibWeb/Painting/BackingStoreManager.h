@@ -30,10 +30,16 @@ public:
     struct BackingStore {
         i32 bitmap_id { -1 };
         RefPtr<Gfx::PaintingSurface> store;
+
+        // The store holding the last painted frame, if there is one. Unchanged pixels can be copied from it.
+        RefPtr<Gfx::PaintingSurface> previous_frame_store;
     };
 
     BackingStore acquire_store_for_next_frame();
 
+    // Must be called if the store handed out by acquire_store_for_next_frame() was not painted into after all.
+    void did_not_paint_acquired_store() { m_front_store_holds_last_frame = false; }
+
     virtual void visit_edges(Cell::Visitor& visitor) override;
 
     BackingStoreManager(HTML::Navigable&);
@@ -48,6 +54,7 @@ private:
     RefPtr<Gfx::PaintingSurface> m_front_store;
     RefPtr<Gfx::PaintingSurface> m_back_store;
     int m_next_bitmap_id { 0 };
+    bool m_front_store_holds_last_frame { false };
 
     RefPtr<Core::Timer> m_backing_store_shrink_timer;
 };
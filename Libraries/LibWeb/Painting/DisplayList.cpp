@@ -79,19 +79,55 @@ static bool command_is_clip_or_mask(DisplayListCommand const& command)
         });
 }
 
-void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface)
+// Filters read back pixels around the area they are applied to, which a repaint clipped to the damaged area would
+// either leave out or take from the previous frame after the filter was already applied there.
+static bool contains_commands_that_read_outside_of_their_bounds(DisplayList const& display_list)
+{
+    for (auto const& command_with_scroll_and_clip : display_list.commands()) {
+        auto const& command = command_with_scroll_and_clip.command;
+        if (command.has<ApplyBackdropFilter>() || command.has<ApplyFilter>())
+            return true;
+        if (auto const* nested = command.get_pointer<PaintNestedDisplayList>(); nested && nested->display_list && contains_commands_that_read_outside_of_their_bounds(*nested->display_list))
+            return true;
+    }
+    return false;
+}
+
+void DisplayListPlayer::execute(DisplayList& display_list, ScrollStateSnapshotByDisplayList&& scroll_state_snapshot_by_display_list, RefPtr<Gfx::PaintingSurface> surface, Optional<PartialRepaint> const& partial_repaint)
 {
     TemporaryChange change { m_scroll_state_snapshots_by_display_list, move(scroll_state_snapshot_by_display_list) };
     if (surface) {
         surface->lock_context();
     }
     auto scroll_state_snapshot = m_scroll_state_snapshots_by_display_list.get(display_list).value_or({});
-    execute_impl(display_list, scroll_state_snapshot, surface);
+    if (surface && partial_repaint.has_value() && !contains_commands_that_read_outside_of_their_bounds(display_list))
+        execute_partial_repaint(display_list, scroll_state_snapshot, *surface, *partial_repaint);
+    else
+        execute_impl(display_list, scroll_state_snapshot, surface);
     if (surface) {
         surface->unlock_context();
     }
 }
 
+void DisplayListPlayer::execute_partial_repaint(DisplayList& display_list, ScrollStateSnapshot const& scroll_state, Gfx::PaintingSurface& surface, PartialRepaint const& partial_repaint)
+{
+    m_surfaces.append(surface);
+    ScopeGuard guard = [&surfaces = m_surfaces] { (void)surfaces.take_last(); };
+
+    copy_surface_contents(*partial_repaint.previous_frame_surface);
+
+    // NOTE: Every command outside of a damage rect is rejected by the clip before it gets rasterized, so the cost of
+    //       this scales with the size of the damage rather than the size of the surface.
+    for (auto const& damage_rect : partial_repaint.damage_rects) {
+        save({});
+        add_clip_rect({ .rect = damage_rect });
+        execute_impl(display_list, scroll_state, nullptr);
+        restore({});
+    }
+
+    flush();
+}
+
 void DisplayListPlayer::apply_clip_frame(ClipFrame const& clip_frame, ScrollStateSnapshot const& scroll_state, DevicePixelConverter const& device_pixel_converter)
 {
     auto const& clip_rects = clip_frame.clip_rects();
@@ -21,11 +21,18 @@
 
 namespace Web::Painting {
 
+// Repaints only some device pixel rects of a surface. Everything outside of them is copied from the surface that holds
+// the previously painted frame.
+struct PartialRepaint {
+    NonnullRefPtr<Gfx::PaintingSurface> previous_frame_surface;
+    Vector<Gfx::IntRect> damage_rects;
+};
+
 class DisplayListPlayer {
 public:
     virtual ~DisplayListPlayer() = default;
 
-    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>);
+    void execute(DisplayList&, ScrollStateSnapshotByDisplayList&&, RefPtr<Gfx::PaintingSurface>, Optional<PartialRepaint> const& = {});
 
 protected:
     Gfx::PaintingSurface& surface() const { return m_surfaces.last(); }
@@ -34,7 +41,10 @@ protected:
     ScrollStateSnapshotByDisplayList m_scroll_state_snapshots_by_display_list;
 
 private:
+    void execute_partial_repaint(DisplayList&, ScrollStateSnapshot const& scroll_state, Gfx::PaintingSurface&, PartialRepaint const&);
+
     virtual void flush() = 0;
+    virtual void copy_surface_contents(Gfx::PaintingSurface const&) = 0;
     virtual void draw_glyph_run(DrawGlyphRun const&) = 0;
     virtual void fill_rect(FillRect const&) = 0;
     virtual void draw_painting_surface(DrawPaintingSurface const&) = 0;
@@ -101,6 +101,14 @@ void DisplayListPlayerSkia::flush()
     surface().flush();
 }
 
+void DisplayListPlayerSkia::copy_surface_contents(Gfx::PaintingSurface const& source)
+{
+    auto image = source.sk_surface().makeImageSnapshot();
+    SkPaint paint;
+    paint.setBlendMode(SkBlendMode::kSrc);
+    surface().canvas().drawImage(image, 0, 0, SkSamplingOptions(), &paint);
+}
+
 void DisplayListPlayerSkia::draw_glyph_run(DrawGlyphRun const& command)
 {
     auto const& gfx_font = command.glyph_run->font();
@@ -23,6 +23,7 @@ public:
 
 private:
     void flush() override;
+    void copy_surface_contents(Gfx::PaintingSurface const&) override;
     void draw_glyph_run(DrawGlyphRun const&) override;
     void fill_rect(FillRect const&) override;
     void draw_painting_surface(DrawPaintingSurface const&) override;
@@ -211,17 +211,28 @@ void Paintable::paint_inspector_overlay(DisplayListRecordingContext& context) co
 void Paintable::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
     auto& document = this->document();
-    if (should_invalidate_display_list == InvalidateDisplayList::Yes)
-        document.invalidate_display_list();
 
     auto* containing_block = this->containing_block();
-    if (!containing_block)
+    if (!containing_block || !is<PaintableWithLines>(*containing_block) || as<PaintableWithLines>(*containing_block).fragments().is_empty()) {
+        if (should_invalidate_display_list == InvalidateDisplayList::Yes)
+            document.invalidate_display_list();
         return;
+    }
 
-    if (!is<PaintableWithLines>(*containing_block))
+    // Fragments are positioned like their containing block, so they only describe the damage if its rect would.
+    // NOTE: Fragment rects don't include the scroll offset of their containing block either.
+    if (!computed_values().text_shadow().is_empty()
+        || !containing_block->absolute_damage_rect().has_value()
+        || !containing_block->scroll_offset().is_zero()) {
+        document.set_needs_display(should_invalidate_display_list);
         return;
-    for (auto const& fragment : as<PaintableWithLines>(*containing_block).fragments())
-        document.set_needs_display(fragment.absolute_rect(), InvalidateDisplayList::No);
+    }
+
+    for (auto const& fragment : as<PaintableWithLines>(*containing_block).fragments()) {
+        // NOTE: Glyphs (e.g. italics) and the text cursor can paint a bit outside of their fragment.
+        auto margin = fragment.absolute_rect().height() / 2;
+        document.set_needs_display(fragment.absolute_rect().inflated(margin, margin, margin, margin), should_invalidate_display_list);
+    }
 }
 
 CSSPixelPoint Paintable::box_type_agnostic_position() const
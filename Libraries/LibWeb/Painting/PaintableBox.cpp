@@ -1407,9 +1407,40 @@ TraversalDecision PaintableWithLines::hit_test(CSSPixelPoint position, HitTestTy
     return TraversalDecision::Continue;
 }
 
+Optional<CSSPixelRect> PaintableBox::absolute_damage_rect() const
+{
+    // The root element and body propagate their backgrounds to the canvas, which covers the whole viewport.
+    auto const& layout_node = layout_node_with_style_and_box_metrics();
+    if (is_viewport_paintable() || layout_node.is_root_element() || layout_node.is_body())
+        return {};
+
+    for (auto const* box = this; box && !box->is_viewport_paintable(); box = box->containing_block()) {
+        if (box->is_fixed_position() || box->is_sticky_position() || box->is_svg_paintable())
+            return {};
+        auto const& computed_values = box->computed_values();
+        if (box->has_css_transform() || computed_values.perspective().has_value())
+            return {};
+        if (computed_values.filter().has_filters() || computed_values.backdrop_filter().has_filters())
+            return {};
+        // NOTE: Absolute rects don't include scroll offsets, those are applied when the display list is played back.
+        if (box != this && !box->scroll_offset().is_zero())
+            return {};
+    }
+
+    auto rect = absolute_paint_rect();
+    if (outline_data().has_value()) {
+        auto outline_extent = computed_values().outline_width() + max(outline_offset(), CSSPixels(0));
+        rect.inflate(outline_extent, outline_extent, outline_extent, outline_extent);
+    }
+    return rect;
+}
+
 void PaintableBox::set_needs_display(InvalidateDisplayList should_invalidate_display_list)
 {
-    document().set_needs_display(absolute_rect(), should_invalidate_display_list);
+    if (auto damage_rect = absolute_damage_rect(); damage_rect.has_value())
+        document().set_needs_display(*damage_rect, should_invalidate_display_list);
+    else
+        document().set_needs_display(should_invalidate_display_list);
 }
 
 Optional<CSSPixelRect> PaintableBox::get_masking_area() const
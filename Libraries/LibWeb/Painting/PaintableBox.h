@@ -87,6 +87,10 @@ public:
     CSSPixelRect overflow_clip_edge_rect() const;
     CSSPixelRect absolute_paint_rect() const;
 
+    // A rect in document coordinates that covers everything painted for this box, if we can tell without accounting
+    // for transforms, filters, fixed or sticky positioning, or scrolled ancestors. Used to only repaint damaged areas.
+    Optional<CSSPixelRect> absolute_damage_rect() const;
+
     // These united versions of the above rects take continuation into account.
     CSSPixelRect absolute_united_border_box_rect() const;
     CSSPixelRect absolute_united_content_rect() const;
@@ -7,6 +7,7 @@
 #include <AK/Debug.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/Environment.h>
+#include <LibCore/MemoryPressureWatcher.h>
 #include <LibCore/StandardPaths.h>
 #include <LibCore/System.h>
 #include <LibCore/TimeZoneWatcher.h>
@@ -110,6 +111,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     Optional<StringView> user_agent_preset;
     Optional<StringView> dns_server_address;
     Optional<StringView> default_time_zone;
+    Optional<u32> js_heap_budget_in_mib;
     Optional<u16> dns_server_port;
     bool use_dns_over_tls = false;
     bool layout_test_mode = false;
@@ -182,6 +184,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(use_dns_over_tls, "Use DNS over TLS", "dot");
     args_parser.add_option(validate_dnssec_locally, "Validate DNSSEC locally", "dnssec");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
+    args_parser.add_option(js_heap_budget_in_mib, "Memory budget for the JavaScript heap of each WebContent process, in MiB", "js-heap-budget", 0, "mib");
 
     args_parser.add_option(Core::ArgsParser::Option {
         .argument_mode = Core::ArgsParser::OptionArgumentMode::Optional,
@@ -283,6 +286,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .collect_garbage_on_every_allocation = collect_garbage_on_every_allocation ? CollectGarbageOnEveryAllocation::Yes : CollectGarbageOnEveryAllocation::No,
         .paint_viewport_scrollbars = disable_scrollbar_painting ? PaintViewportScrollbars::No : PaintViewportScrollbars::Yes,
         .default_time_zone = default_time_zone,
+        .js_heap_budget_in_mib = js_heap_budget_in_mib,
     };
 
     create_platform_options(m_browser_options, m_request_server_options, m_web_content_options);
@@ -390,6 +394,23 @@ ErrorOr<void> Application::launch_services()
         }
     }
 
+    if (auto memory_pressure_watcher = Core::MemoryPressureWatcher::create(); memory_pressure_watcher.is_error()) {
+        dbgln("Unable to monitor system memory pressure: {}", memory_pressure_watcher.error());
+    } else {
+        m_memory_pressure_watcher = memory_pressure_watcher.release_value();
+
+        m_memory_pressure_watcher->on_memory_pressure = [this](Core::MemoryPressureWatcher::Level level) {
+            switch (level) {
+            case Core::MemoryPressureWatcher::Level::Moderate:
+                did_receive_memory_pressure(GC::Heap::MemoryPressure::Moderate);
+                break;
+            case Core::MemoryPressureWatcher::Level::Critical:
+                did_receive_memory_pressure(GC::Heap::MemoryPressure::Critical);
+                break;
+            }
+        };
+    }
+
     TRY(launch_request_server());
     TRY(launch_image_decoder_server());
 
@@ -978,6 +999,14 @@ Optional<Core::TimeZoneWatcher&> Application::time_zone_watcher()
     return {};
 }
 
+void Application::did_receive_memory_pressure(GC::Heap::MemoryPressure pressure)
+{
+    WebContentClient::for_each_client([&](WebView::WebContentClient& client) {
+        client.async_did_receive_memory_pressure(pressure);
+        return IterationDecision::Continue;
+    });
+}
+
 Vector<DevTools::TabDescription> Application::tab_list() const
 {
     Vector<DevTools::TabDescription> tabs;
@@ -134,6 +134,11 @@ static ErrorOr<NonnullRefPtr<WebView::WebContentClient>> launch_web_content_proc
         arguments.append(web_content_options.default_time_zone.value());
     }
 
+    if (auto const maybe_js_heap_budget = web_content_options.js_heap_budget_in_mib; maybe_js_heap_budget.has_value()) {
+        arguments.append("--js-heap-budget"sv);
+        arguments.append(ByteString::number(maybe_js_heap_budget.value()));
+    }
+
     if (auto server = mach_server_name(); server.has_value()) {
         arguments.append("--mach-server-name"sv);
         arguments.append(server.value());
@@ -172,6 +172,7 @@ struct WebContentOptions {
     Optional<u16> echo_server_port {};
     PaintViewportScrollbars paint_viewport_scrollbars { PaintViewportScrollbars::Yes };
     Optional<StringView> default_time_zone {};
+    Optional<u32> js_heap_budget_in_mib {};
 };
 
 }
@@ -17,6 +17,7 @@
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
 #include <LibUnicode/TimeZone.h>
@@ -1349,4 +1350,15 @@ void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
     }
 }
 
+void ConnectionFromClient::did_receive_memory_pressure(GC::Heap::MemoryPressure pressure)
+{
+    // NOTE: We use deferred_invoke here to ensure that GC runs with as little on the stack as possible.
+    Core::deferred_invoke([pressure] {
+        auto& vm = Web::Bindings::main_thread_vm();
+        if (pressure == GC::Heap::MemoryPressure::Critical)
+            vm.program_cache().clear();
+        vm.heap().did_receive_memory_pressure(pressure);
+    });
+}
+
 }
@@ -162,6 +162,8 @@ private:
     virtual void system_time_zone_changed() override;
     virtual void cookies_changed(Vector<Web::Cookie::Cookie>) override;
 
+    virtual void did_receive_memory_pressure(GC::Heap::MemoryPressure) override;
+
     NonnullOwnPtr<PageHost> m_page_host;
 
     HashMap<int, Web::FileRequest> m_requested_files {};
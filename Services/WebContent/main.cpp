@@ -103,6 +103,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_scrollbar_painting = false;
     StringView echo_server_port_string_view {};
     StringView default_time_zone {};
+    Optional<u32> js_heap_budget_in_mib;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(command_line, "Browser process command line", "command-line", 0, "command_line");
@@ -126,6 +127,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(echo_server_port_string_view, "Echo server port used in test internals", "echo-server-port", 0, "echo_server_port");
     args_parser.add_option(is_headless, "Report that the browser is running in headless mode", "headless");
     args_parser.add_option(default_time_zone, "Default time zone", "default-time-zone", 0, "time-zone-id");
+    args_parser.add_option(js_heap_budget_in_mib, "Memory budget for the JavaScript heap, in MiB", "js-heap-budget", 0, "mib");
 
     args_parser.parse(arguments);
 
@@ -197,6 +199,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
     if (collect_garbage_on_every_allocation)
         Web::Bindings::main_thread_vm().heap().set_should_collect_on_every_allocation(true);
+    if (js_heap_budget_in_mib.has_value())
+        Web::Bindings::main_thread_vm().heap().set_memory_budget(static_cast<size_t>(*js_heap_budget_in_mib) * MiB);
 
     TRY(initialize_resource_loader(Web::Bindings::main_thread_vm().heap(), request_server_socket));
 
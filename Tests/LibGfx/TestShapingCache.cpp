@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2025, Ladybird contributors
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/ScopeGuard.h>
+#include <AK/Utf16String.h>
+#include <LibCore/MappedFile.h>
+#include <LibGfx/Font/Font.h>
+#include <LibGfx/Font/WOFF2/Loader.h>
+#include <LibGfx/TextLayout.h>
+#include <LibTest/TestCase.h>
+
+#define TEST_INPUT(x) ("test-inputs/" x)
+
+static NonnullRefPtr<Gfx::Typeface> load_test_typeface()
+{
+    static auto file = MUST(Core::MappedFile::map(TEST_INPUT("woff2/incorrect_sfnt_size.woff2"sv)));
+    return MUST(WOFF2::try_load_from_bytes(file->bytes()));
+}
+
+static void shape(Gfx::Font const& font, size_t index)
+{
+    auto text = Utf16String::formatted("shaping cache entry {}", index);
+    (void)Gfx::shape_text({}, 0, text.utf16_view(), font, Gfx::GlyphRun::TextType::Common, {});
+}
+
+TEST_CASE(evicts_least_recently_used_entries_once_over_budget)
+{
+    Gfx::Font::ShapingCache::set_byte_budget(4 * KiB);
+    ScopeGuard restore_budget = [] { Gfx::Font::ShapingCache::set_byte_budget(Gfx::Font::ShapingCache::default_byte_budget); };
+
+    auto font = load_test_typeface()->font(12);
+    auto eviction_count_before = Gfx::Font::ShapingCache::statistics().eviction_count;
+
+    for (size_t i = 0; i < 1000; ++i)
+        shape(font, i);
+
+    auto const& statistics = Gfx::Font::ShapingCache::statistics();
+    EXPECT(statistics.eviction_count > eviction_count_before);
+    EXPECT(statistics.byte_count <= Gfx::Font::ShapingCache::byte_budget());
+
+    // The most recently shaped text must have survived the evictions.
+    auto hit_count_before = statistics.hit_count;
+    shape(font, 999);
+    EXPECT_EQ(statistics.hit_count, hit_count_before + 1);
+}
+
+TEST_CASE(shrinking_the_budget_evicts_entries)
+{
+    auto font = load_test_typeface()->font(13);
+    for (size_t i = 0; i < 100; ++i)
+        shape(font, i);
+
+    EXPECT(Gfx::Font::ShapingCache::statistics().entry_count > 0);
+    Gfx::Font::ShapingCache::set_byte_budget(0);
+    EXPECT_EQ(Gfx::Font::ShapingCache::statistics().entry_count, 0u);
+    EXPECT_EQ(Gfx::Font::ShapingCache::statistics().byte_count, 0u);
+    Gfx::Font::ShapingCache::set_byte_budget(Gfx::Font::ShapingCache::default_byte_budget);
+}
+
+TEST_CASE(destroying_a_font_drops_its_entries)
+{
+    auto entry_count_before = Gfx::Font::ShapingCache::statistics().entry_count;
+
+    // A typeface only keeps the fonts of its 128 most recent sizes alive, so going through more sizes than that
+    // destroys fonts that still have entries in the shared LRU list.
+    auto typeface = load_test_typeface();
+    for (size_t size = 1; size <= 200; ++size)
+        shape(typeface->font(size), 0);
+
+    auto entry_count_after = Gfx::Font::ShapingCache::statistics().entry_count;
+    EXPECT(entry_count_after > entry_count_before);
+    EXPECT(entry_count_after <= entry_count_before + 129);
+
+    // The entries of the fonts that are still alive must be unaffected.
+    auto font = typeface->font(200);
+    auto hit_count_before = Gfx::Font::ShapingCache::statistics().hit_count;
+    shape(font, 0);
+    EXPECT_EQ(Gfx::Font::ShapingCache::statistics().hit_count, hit_count_before + 1);
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/Map.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibTest/TestCase.h>
+
+static constexpr i32 ENTRY_COUNT = 1'000'000;
+
+static JS::Realm& realm()
+{
+    static auto vm = JS::VM::create();
+    static auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    return *execution_context->realm;
+}
+
+static GC::Ref<JS::Map> create_filled_map()
+{
+    auto map = JS::Map::create(realm());
+    for (i32 i = 0; i < ENTRY_COUNT; ++i)
+        map->map_set(JS::Value(i), JS::Value(i));
+    return map;
+}
+
+BENCHMARK_CASE(insert)
+{
+    auto map = create_filled_map();
+    EXPECT_EQ(map->map_size(), static_cast<size_t>(ENTRY_COUNT));
+}
+
+BENCHMARK_CASE(insert_and_delete)
+{
+    auto map = create_filled_map();
+    for (i32 i = 0; i < ENTRY_COUNT; ++i)
+        EXPECT(map->map_remove(JS::Value(i)));
+    EXPECT_EQ(map->map_size(), 0u);
+}
+
+BENCHMARK_CASE(iterate)
+{
+    auto map = create_filled_map();
+    double sum = 0;
+    for (auto const& entry : *map)
+        sum += entry.value.as_double();
+    EXPECT_EQ(sum, static_cast<double>(ENTRY_COUNT) * (ENTRY_COUNT - 1) / 2);
+}
+
+BENCHMARK_CASE(iterate_after_deleting_every_other_entry)
+{
+    auto map = create_filled_map();
+    for (i32 i = 0; i < ENTRY_COUNT; i += 2)
+        map->map_remove(JS::Value(i));
+
+    size_t count = 0;
+    for (auto const& entry : *map) {
+        (void)entry;
+        ++count;
+    }
+    EXPECT_EQ(count, static_cast<size_t>(ENTRY_COUNT / 2));
+}
@@ -1085,6 +1085,85 @@ TEST_CASE(theoretically_infinite_loop)
     }
 }
 
+TEST_CASE(catastrophic_backtracking)
+{
+    {
+        // The first alternative takes exponential time to backtrack out of, the match must come from the second one.
+        Regex<ECMA262> re("(a+)+b|(a+)$");
+        auto input = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"sv;
+        auto result = re.match(input);
+
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), input);
+        EXPECT(result.capture_group_matches.first()[0].view.is_null());
+        EXPECT_EQ(result.capture_group_matches.first()[1].view.to_byte_string(), input);
+    }
+    {
+        // Same, but with compares that consume more than one character at a time.
+        Regex<ECMA262> re("^(?:(?:a|ab|abc|b|bc|c)+)+x|^(abc)+$");
+        auto input = "abcabcabcabcabcabcabcabcabcabcabcabc"sv;
+        auto result = re.match(input);
+
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), input);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "abc"sv);
+    }
+    {
+        Regex<ECMA262> re("^(a|aa)+$");
+        auto input = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaab"sv;
+        auto result = re.match(input);
+        EXPECT_EQ(result.success, false);
+    }
+}
+
+static void expect_match_columns(RegexResult const& result, ReadonlySpan<size_t> expected_columns)
+{
+    EXPECT_EQ(result.success, !expected_columns.is_empty());
+    EXPECT_EQ(result.matches.size(), expected_columns.size());
+    for (size_t i = 0; i < min(result.matches.size(), expected_columns.size()); ++i)
+        EXPECT_EQ(result.matches[i].column, expected_columns[i]);
+}
+
+TEST_CASE(search_skips_to_candidate_positions)
+{
+    auto check_matches = [](Regex<ECMA262> const& re, StringView subject, ReadonlySpan<size_t> expected_columns) {
+        // Once as bytes, and once as UTF-16 with a trailing non-ASCII character so the view isn't stored as ASCII.
+        auto utf16_subject = Utf16String::formatted("{}\u00e9", subject);
+        expect_match_columns(re.match(subject), expected_columns);
+        expect_match_columns(re.match(utf16_subject.utf16_view()), expected_columns);
+    };
+
+    {
+        Regex<ECMA262> re("foo\\d", ECMAScriptFlags::Global);
+        check_matches(re, "fo foo1 fofoo2 foox foo3 f"sv, Array<size_t, 3> { 3, 10, 20 });
+    }
+    {
+        Regex<ECMA262> re("x\\d+", ECMAScriptFlags::Global);
+        check_matches(re, "ax1 x x22 y"sv, Array<size_t, 2> { 1, 6 });
+    }
+}
+
+TEST_CASE(hot_pattern_matches_like_cold_pattern)
+{
+    // After enough matches, single-character compares are answered from precomputed tables; they must agree
+    // with the interpreter, including for case folding, inverted classes and non-ASCII input.
+    auto check_pattern = [](Regex<ECMA262> const& re, StringView subject, ReadonlySpan<size_t> expected_columns) {
+        for (size_t run = 0; run < 64; ++run)
+            expect_match_columns(re.match(subject), expected_columns);
+    };
+
+    {
+        Regex<ECMA262> re("[a-c][^\\d\\s]\\w", ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        check_pattern(re, "Ab1 bXy c_z a9z"sv, Array<size_t, 3> { 0, 4, 8 });
+    }
+    {
+        Regex<ECMA262> re("[^a-z]\\d", ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive | ECMAScriptFlags::Unicode);
+        check_pattern(re, "\u00e91 A2 b3 #4"sv, Array<size_t, 2> { 0, 9 });
+    }
+}
+
 static auto g_lots_of_a_s = String::repeated('a', 10'000'000).release_value();
 
 BENCHMARK_CASE(fork_performance)
@@ -1116,6 +1195,23 @@ BENCHMARK_CASE(anchor_performance)
     }
 }
 
+BENCHMARK_CASE(character_class_performance)
+{
+    Regex<ECMA262> re("^[\\w.+-]+@[a-z\\d-]+(?:\\.[a-z\\d-]+)*\\.[a-z]{2,}$", ECMAScriptFlags::Insensitive);
+    Array subjects {
+        "someone.else+tag@example.com"sv,
+        "first_last@sub-domain.example.org"sv,
+        "not an address"sv,
+        "missing-at-sign.example.com"sv,
+    };
+    for (auto i = 0; i < 100'000; i++) {
+        for (auto subject : subjects) {
+            auto result = re.match(subject);
+            EXPECT_EQ(result.success, subject.contains('@'));
+        }
+    }
+}
+
 TEST_CASE(optimizer_atomic_groups)
 {
     Array tests {
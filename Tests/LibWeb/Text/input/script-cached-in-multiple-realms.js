@@ -0,0 +1,128 @@
+// NOTE: This script has to be at least 8 KiB, so that it is kept in the ProgramCache and both realms share its parse tree.
+
+function readGlobals() {
+    return `${alpha} ${beta}`;
+}
+
+function writeGlobals(suffix) {
+    alpha += suffix;
+    beta += suffix;
+}
+
+function tag(strings) {
+    return strings;
+}
+
+function templateObject() {
+    return tag`site`;
+}
+
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
+// This line only makes the script large enough to be cached, and is repeated below.
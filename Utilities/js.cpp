@@ -819,6 +819,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_debug_printing = false;
     bool use_test262_global = false;
     bool parse_only = false;
+    bool disable_bytecode_optimizations = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
 
@@ -827,6 +828,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(parse_only, "Parse only", "parse-only", 'p');
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_dump_bytecode_pass_statistics, "Dump instruction counts before and after each bytecode pass", "dump-bytecode-pass-statistics", {});
+    args_parser.add_option(disable_bytecode_optimizations, "Disable bytecode optimization passes", "disable-bytecode-optimizations", {});
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -840,6 +843,8 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
+    JS::Bytecode::g_optimize_bytecode = !disable_bytecode_optimizations;
+
     [[maybe_unused]] bool syntax_highlight = !disable_syntax_highlight;
 
     AK::set_debug_enabled(!disable_debug_printing);